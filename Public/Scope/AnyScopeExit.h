@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "Details/InlineFunction.h"
+#include "Details/Traits.h"
+
+namespace stdx {
+    template <std::size_t Size = 4 * sizeof(void*)>
+    class BasicAnyScopeExit {
+        using TFunction = details::InlineFunction<Size>;
+
+    public:
+        BasicAnyScopeExit() noexcept = default;
+
+        template <
+            typename U,
+            typename F = std::decay_t<U>,
+            typename std::enable_if_t<!std::is_same_v<details::RemoveCVRef<U>, BasicAnyScopeExit> && std::is_nothrow_invocable_v<details::UnwrapReferenceType<F>&>, int> = 0>
+        explicit BasicAnyScopeExit(U&& Function) noexcept(std::is_nothrow_constructible_v<F, U>) {
+            static_assert(TFunction::template Fits<F>, "Callable does not fit into the inline storage");
+
+            if constexpr (std::is_nothrow_constructible_v<F, U>) {
+                this->Function.template Emplace<F>(std::forward<U>(Function));
+            } else {
+                try {
+                    this->Function.template Emplace<F>(std::as_const(Function));
+                } catch (...) {
+                    std::invoke(Function);
+                    throw;
+                }
+            }
+        }
+
+        BasicAnyScopeExit(const BasicAnyScopeExit&) = delete;
+
+        BasicAnyScopeExit(BasicAnyScopeExit&& Other) :
+            Function(std::move(Other.Function)),
+            bExecuteOnDestruction(Other.bExecuteOnDestruction) {
+            Other.Release();
+        }
+
+        ~BasicAnyScopeExit() {
+            if (bExecuteOnDestruction && Function) {
+                std::invoke(Function);
+            }
+        }
+
+        BasicAnyScopeExit& operator=(const BasicAnyScopeExit&) = delete;
+
+        BasicAnyScopeExit& operator=(BasicAnyScopeExit&&) = delete;
+
+        void Release() noexcept {
+            bExecuteOnDestruction = false;
+        }
+
+    private:
+        TFunction Function;
+        bool bExecuteOnDestruction = true;
+    };
+
+    using AnyScopeExit = BasicAnyScopeExit<>;
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <new>
+
+#include "Scope.h"
+
+namespace stdx {
+    class Arena final : public std::pmr::memory_resource {
+        struct alignas(std::max_align_t) Chunk {
+            Chunk* Next;
+            std::size_t Size;
+            bool bOwned;
+        };
+
+    public:
+        struct Mark {
+            Chunk* Current;
+            std::uintptr_t Cursor;
+        };
+
+        explicit Arena(
+            std::size_t ChunkSize = 64 * 1024,
+            std::pmr::memory_resource* Upstream = std::pmr::get_default_resource()) noexcept :
+            Upstream(Upstream),
+            NextSize(std::max(ChunkSize, sizeof(Chunk))) { }
+
+        Arena(
+            void* Buffer,
+            std::size_t Size,
+            std::size_t ChunkSize = 64 * 1024,
+            std::pmr::memory_resource* Upstream = std::pmr::get_default_resource()) noexcept :
+            Arena(ChunkSize, Upstream) {
+            const std::uintptr_t Begin = AlignUp(reinterpret_cast<std::uintptr_t>(Buffer), alignof(Chunk));
+            const std::uintptr_t End = reinterpret_cast<std::uintptr_t>(Buffer) + Size;
+            if (End > Begin && End - Begin > sizeof(Chunk)) {
+                First = ::new (reinterpret_cast<void*>(Begin)) Chunk{nullptr, End - Begin - sizeof(Chunk), false};
+                Activate(First);
+            }
+        }
+
+        Arena(const Arena&) = delete;
+
+        Arena(Arena&&) = delete;
+
+        ~Arena() override {
+            Release();
+        }
+
+        Arena& operator=(const Arena&) = delete;
+
+        Arena& operator=(Arena&&) = delete;
+
+        [[nodiscard]] void* Allocate(std::size_t Size, std::size_t Alignment = alignof(std::max_align_t)) {
+            const std::uintptr_t Aligned = AlignUp(Cursor, Alignment);
+            if (Cursor != 0 && Aligned >= Cursor && Aligned <= Limit && Limit - Aligned >= Size) {
+                Cursor = Aligned + Size;
+                return reinterpret_cast<void*>(Aligned);
+            }
+            return AllocateSlow(Size, Alignment);
+        }
+
+        [[nodiscard]] Mark GetMark() const noexcept {
+            return {Current, Cursor};
+        }
+
+        void Rewind(const Mark& Value) noexcept {
+            if (Value.Current) {
+                Current = Value.Current;
+                Cursor = Value.Cursor;
+                Limit = GetBegin(Current) + Current->Size;
+            } else if (First) {
+                Activate(First);
+            }
+        }
+
+        [[nodiscard]] auto Checkpoint() noexcept {
+            return ScopeExit([this, Value = GetMark()]() noexcept { Rewind(Value); });
+        }
+
+        void Reset() noexcept {
+            Rewind(Mark{nullptr, 0});
+        }
+
+        void Release() noexcept {
+            Chunk* Buffer = nullptr;
+            while (First) {
+                Chunk* Value = std::exchange(First, First->Next);
+                if (Value->bOwned) {
+                    Upstream->deallocate(Value, sizeof(Chunk) + Value->Size, alignof(Chunk));
+                } else {
+                    Buffer = Value;
+                }
+            }
+            Current = nullptr;
+            Cursor = Limit = 0;
+
+            if (Buffer) {
+                Buffer->Next = nullptr;
+                First = Buffer;
+                Activate(First);
+            }
+        }
+
+        [[nodiscard]] std::pmr::memory_resource* GetUpstream() const noexcept {
+            return Upstream;
+        }
+
+    protected:
+        void* do_allocate(std::size_t Size, std::size_t Alignment) override {
+            return Allocate(Size, Alignment);
+        }
+
+        void do_deallocate(void*, std::size_t, std::size_t) override { }
+
+        bool do_is_equal(const std::pmr::memory_resource& Other) const noexcept override {
+            return this == &Other;
+        }
+
+    private:
+        static std::uintptr_t AlignUp(std::uintptr_t Value, std::size_t Alignment) noexcept {
+            return (Value + Alignment - 1) & ~std::uintptr_t(Alignment - 1);
+        }
+
+        static std::uintptr_t GetBegin(Chunk* Value) noexcept {
+            return reinterpret_cast<std::uintptr_t>(Value + 1);
+        }
+
+        void Activate(Chunk* Value) noexcept {
+            Current = Value;
+            Cursor = GetBegin(Value);
+            Limit = Cursor + Value->Size;
+        }
+
+        void* AllocateSlow(std::size_t Size, std::size_t Alignment) {
+            if (Size > std::numeric_limits<std::size_t>::max() - Alignment - sizeof(Chunk)) {
+                throw std::bad_alloc();
+            }
+            Size = std::max<std::size_t>(Size, 1);
+
+            Chunk* Last = Current;
+            for (Chunk* Next = Current ? Current->Next : First; Next; Next = Next->Next) {
+                Last = Next;
+                if (Next->Size >= Size + Alignment) {
+                    Activate(Next);
+                    return Allocate(Size, Alignment);
+                }
+            }
+
+            const std::size_t Capacity = std::max(NextSize, Size + Alignment);
+            void* Memory = Upstream->allocate(sizeof(Chunk) + Capacity, alignof(Chunk));
+            auto* Value = ::new (Memory) Chunk{nullptr, Capacity, true};
+            NextSize = Capacity * 2;
+
+            if (Last) {
+                Value->Next = std::exchange(Last->Next, Value);
+            } else {
+                Value->Next = std::exchange(First, Value);
+            }
+            Activate(Value);
+            return Allocate(Size, Alignment);
+        }
+
+        std::pmr::memory_resource* Upstream;
+        Chunk* First = nullptr;
+        Chunk* Current = nullptr;
+        std::uintptr_t Cursor = 0;
+        std::uintptr_t Limit = 0;
+        std::size_t NextSize;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "EpochDomain.h"
+#include "UniqueResource.h"
+
+namespace stdx {
+    template <typename R, typename D, typename S = void>
+    class AtomicUniqueResource {
+        using TResource = UniqueResource<R, D, S>;
+        using TNode = details::RetiredValue<TResource>;
+
+    public:
+        AtomicUniqueResource() noexcept = default;
+
+        explicit AtomicUniqueResource(TResource&& Value) : Current(new TNode(std::move(Value))) { }
+
+        AtomicUniqueResource(const AtomicUniqueResource&) = delete;
+
+        AtomicUniqueResource(AtomicUniqueResource&&) = delete;
+
+        ~AtomicUniqueResource() {
+            delete Current.load(std::memory_order_acquire);
+        }
+
+        AtomicUniqueResource& operator=(const AtomicUniqueResource&) = delete;
+
+        AtomicUniqueResource& operator=(AtomicUniqueResource&&) = delete;
+
+        [[nodiscard]] const TResource* Load(const EpochDomain::Guard&) const noexcept {
+            return GetValue(Current.load(std::memory_order_acquire));
+        }
+
+        const TResource* Load(const EpochDomain::Guard&&) const = delete;
+
+        void Store(EpochDomain::Participant& Writer, TResource&& Value) {
+            (void) Exchange(Writer, std::move(Value));
+        }
+
+        // The previous value is already retired: it stays valid only while Writer holds a guard entered before this call.
+        const TResource* Exchange(EpochDomain::Participant& Writer, TResource&& Value) {
+            return Retire(Writer, Current.exchange(new TNode(std::move(Value)), std::memory_order_acq_rel));
+        }
+
+        bool CompareExchange(EpochDomain::Participant& Writer, const TResource*& Expected, TResource&& Desired) {
+            TNode* Previous = Current.load(std::memory_order_acquire);
+            if (GetValue(Previous) != Expected) {
+                Expected = GetValue(Previous);
+                return false;
+            }
+
+            TNode* Node = new TNode(std::move(Desired));
+            do {
+                if (Current.compare_exchange_weak(Previous, Node, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    Retire(Writer, Previous);
+                    return true;
+                }
+            } while (GetValue(Previous) == Expected);
+            Expected = GetValue(Previous);
+
+            GiveBack(Desired, Node);
+            return false;
+        }
+
+        void Reset(EpochDomain::Participant& Writer) noexcept {
+            Retire(Writer, Current.exchange(nullptr, std::memory_order_acq_rel));
+        }
+
+    private:
+        static const TResource* GetValue(TNode* Node) noexcept {
+            return Node ? &Node->Value : nullptr;
+        }
+
+        static void GiveBack(TResource& Desired, TNode* Node) noexcept {
+            if constexpr (std::is_nothrow_move_assignable_v<TResource>) {
+                Desired = std::move(Node->Value);
+            } else {
+                static_assert(std::is_nothrow_move_constructible_v<TResource>);
+                Desired.~TResource();
+                ::new (static_cast<void*>(std::addressof(Desired))) TResource(std::move(Node->Value));
+            }
+            delete Node;
+        }
+
+        static const TResource* Retire(EpochDomain::Participant& Writer, TNode* Node) noexcept {
+            if (Node) {
+                Writer.RetireNode(Node);
+            }
+            return GetValue(Node);
+        }
+
+        std::atomic<TNode*> Current = nullptr;
+    };
+}
\ No newline at end of file
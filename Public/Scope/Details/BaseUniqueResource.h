@@ -3,18 +3,36 @@
 #include <tuple>
 #include <utility>
 
+#include "CompressedPair.h"
 #include "ResourceBox.h"
 #include "Traits.h"
 
 namespace stdx::details {
+    template <typename S>
+    struct EngagedState { };
+
+    template <>
+    struct EngagedState<void> {
+        explicit EngagedState(bool bExecuteOnReset = false) noexcept : bExecuteOnReset(bExecuteOnReset) { }
+
+        bool bExecuteOnReset;
+    };
+
     template <typename R, typename D>
-    struct BaseUniqueResource {
+    constexpr bool IsTriviallyDestructibleResource = std::is_same_v<std::decay_t<D>, NoopDeleter> &&
+        std::is_trivially_destructible_v<ResourceBox<R>> && std::is_trivially_destructible_v<ResourceBox<D>>;
+
+    template <typename R, typename D, typename S>
+    struct BaseUniqueResource : EngagedState<S> {
         using TResource = ResourceBox<R>;
         using TDestruct = ResourceBox<D>;
+        using TData = CompressedPair<TResource, TDestruct>;
 
         using R1 = typename TResource::Type;
         using D1 = typename TDestruct::Type;
 
+        static constexpr bool HasSentinel = !std::is_void_v<S>;
+
         static_assert(std::is_invocable_v<D1&, decltype(std::declval<TResource&>().Get())>);
 
         template <typename... T1, typename... T2>
@@ -22,6 +40,10 @@ namespace stdx::details {
             return std::is_nothrow_constructible_v<TResource, T1...> && std::is_nothrow_constructible_v<TDestruct, T2...>;
         }
 
+        static constexpr bool IsMoveConstructible() noexcept {
+            return std::is_move_constructible_v<TResource> && std::is_move_constructible_v<TDestruct>;
+        }
+
         static constexpr bool IsAssignable() noexcept {
             return std::is_move_assignable_v<TResource> && std::is_move_assignable_v<TDestruct>;
         }
@@ -38,34 +60,118 @@ namespace stdx::details {
             return std::is_nothrow_move_constructible_v<TDestruct>;
         }
 
-        BaseUniqueResource() = default;
+        template <typename T>
+        static constexpr bool IsValid([[maybe_unused]] const T& Value) noexcept {
+            if constexpr (HasSentinel) {
+                return !bool(Value == S::Invalid());
+            } else {
+                return true;
+            }
+        }
+
+        template <typename T = TData, typename std::enable_if_t<std::is_default_constructible_v<T>, int> = 0>
+        BaseUniqueResource() noexcept(std::is_nothrow_default_constructible_v<T>) {
+            if constexpr (HasSentinel) {
+                Release();
+            }
+        }
 
         template <typename... T1, typename... T2>
         BaseUniqueResource(std::tuple<T1...>&& Resource, std::tuple<T2...>&& Destruct, bool bExecuteOnReset) noexcept(
             IsNoExceptConstructible(details::TypePack<T1...>{}, details::TypePack<T2...>{})) :
-            Data(std::piecewise_construct, std::move(Resource), std::move(Destruct)),
-            bExecuteOnReset(bExecuteOnReset) { }
+            Data(std::piecewise_construct, std::move(Resource), std::move(Destruct)) {
+            SetExecuteOnReset(bExecuteOnReset);
+        }
 
         BaseUniqueResource(const BaseUniqueResource&) = delete;
 
-        BaseUniqueResource(BaseUniqueResource&&) = delete;
+#if SCOPE_HAS_CONCEPTS
+        BaseUniqueResource(BaseUniqueResource&& Other) noexcept(IsResourceMoveNoExcept() && IsDestructMoveNoExcept()) requires(
+            IsMoveConstructible()) :
+#else
+        BaseUniqueResource(std::conditional_t<IsMoveConstructible(), BaseUniqueResource, Nonesuch>&& Other) noexcept(
+            IsResourceMoveNoExcept() && IsDestructMoveNoExcept()) :
+#endif
+            BaseUniqueResource(
+                std::forward_as_tuple(std::move(Other.Resource())),
+                MoveDestructArgs(this, Other),
+                Other.IsEngaged()) {
+            Other.Release();
+        }
+
+#if SCOPE_HAS_CONCEPTS
+        ~BaseUniqueResource() requires IsTriviallyDestructibleResource<R, D> = default;
 
         ~BaseUniqueResource() {
             Reset();
         }
+#endif
 
         BaseUniqueResource& operator=(const BaseUniqueResource&) = delete;
 
-        BaseUniqueResource& operator=(BaseUniqueResource&& Other) = delete;
+#if SCOPE_HAS_CONCEPTS
+        BaseUniqueResource& operator=(BaseUniqueResource&& Other) noexcept(IsNoExceptAssignable()) requires(IsAssignable()) {
+#else
+        BaseUniqueResource& operator=(std::conditional_t<IsAssignable(), BaseUniqueResource, Nonesuch>&& Other) noexcept(
+            IsNoExceptAssignable()) {
+#endif
+            constexpr auto IsResourceNoExceptAssignable = std::is_nothrow_move_assignable_v<TResource>;
+            constexpr auto IsDestructNoExceptAssignable = std::is_nothrow_move_assignable_v<TDestruct>;
+
+            Reset();
+
+            const bool bExecuteOnReset = Other.IsEngaged();
+
+            if constexpr (IsResourceNoExceptAssignable && !IsDestructNoExceptAssignable) {
+                Destruct() = std::move(Other.Destruct());
+                Resource() = std::move(Other.Resource());
+            } else {
+                Resource() = std::move(Other.Resource());
+                Destruct() = std::move(Other.Destruct());
+            }
+
+            SetExecuteOnReset(bExecuteOnReset);
+            Other.Release();
+
+            return *this;
+        }
+
+        SCOPE_FORCE_INLINE bool IsEngaged() const noexcept {
+            if constexpr (HasSentinel) {
+                return IsValid(Resource().Get());
+            } else {
+                return this->bExecuteOnReset;
+            }
+        }
+
+        void SetExecuteOnReset(bool bExecuteOnReset) noexcept {
+            if constexpr (HasSentinel) {
+                if (!bExecuteOnReset) {
+                    Release();
+                }
+            } else {
+                this->bExecuteOnReset = bExecuteOnReset;
+            }
+        }
 
         void Release() noexcept {
-            bExecuteOnReset = false;
+            if constexpr (HasSentinel) {
+                static_assert(!std::is_reference_v<R> && std::is_nothrow_assignable_v<R1&, decltype(S::Invalid())>);
+                Resource() = S::Invalid();
+            } else {
+                this->bExecuteOnReset = false;
+            }
         }
 
         void Reset() noexcept {
-            if (bExecuteOnReset) {
-                Release();
-                std::invoke(Destruct().Get(), Resource().Get());
+            if (IsEngaged()) {
+                if constexpr (HasSentinel) {
+                    std::invoke(Destruct().Get(), Resource().Get());
+                    Release();
+                } else {
+                    Release();
+                    std::invoke(Destruct().Get(), Resource().Get());
+                }
             }
         }
 
@@ -82,111 +188,83 @@ namespace stdx::details {
             if constexpr (std::is_nothrow_assignable_v<R1&, T>) {
                 Resource() = std::forward<T>(Value);
             } else {
-                ScopeExit Scope([this, &Value]() { std::invoke(Destruct().Get(), Value); });
+                ScopeExit Scope([this, &Value]() {
+                    if (IsValid(Value)) {
+                        std::invoke(Destruct().Get(), Value);
+                    }
+                });
                 Resource() = std::as_const(Value);
                 Scope.Release();
             }
 
-            bExecuteOnReset = true;
+            SetExecuteOnReset(true);
         }
 
-        TResource& Resource() noexcept {
-            return Data.first;
+        SCOPE_FORCE_INLINE TResource& Resource() noexcept {
+            return Data.First();
         }
 
-        const TResource& Resource() const noexcept {
-            return Data.first;
+        SCOPE_FORCE_INLINE const TResource& Resource() const noexcept {
+            return Data.First();
         }
 
-        TDestruct& Destruct() noexcept {
-            return Data.second;
+        SCOPE_FORCE_INLINE TDestruct& Destruct() noexcept {
+            return Data.Second();
         }
 
-        const TDestruct& Destruct() const noexcept {
-            return Data.second;
+        SCOPE_FORCE_INLINE const TDestruct& Destruct() const noexcept {
+            return Data.Second();
         }
 
-        std::pair<TResource, TDestruct> Data;
-        bool bExecuteOnReset = false;
-    };
-
-    template <typename R, typename D, bool = BaseUniqueResource<R, D>::IsDestructMoveNoExcept()>
-    struct UniqueResourceMove : BaseUniqueResource<R, D> {
-        using Super = BaseUniqueResource<R, D>;
-        using Super::Super;
-
-        UniqueResourceMove() = default;
-
-        UniqueResourceMove(UniqueResourceMove&& Other) :
-            Super(
-                std::forward_as_tuple(std::move(Other.Resource())),
-                std::forward_as_tuple(std::move(Other.Destruct()), GetSafeScope(Other)),
-                false) {
-            Super::bExecuteOnReset = std::exchange(Other.bExecuteOnReset, false);
-        }
-
-        UniqueResourceMove& operator=(UniqueResourceMove&&) = default;
-
-        auto GetSafeScope(UniqueResourceMove& Other) noexcept {
-            return ScopeExit([this, &Other]() {
-                if constexpr (std::is_nothrow_move_constructible_v<R>) {
-                    if (Other.bExecuteOnReset) {
-                        std::invoke(Other.Destruct().Get(), Super::Resource().Get());
-                        Other.Release();
+        static auto MoveDestructArgs([[maybe_unused]] BaseUniqueResource* Self, BaseUniqueResource& Other) noexcept {
+            if constexpr (IsDestructMoveNoExcept()) {
+                return std::forward_as_tuple(std::move(Other.Destruct()));
+            } else {
+                auto Scope = ScopeExit([Self, &Other, bEngaged = Other.IsEngaged()]() {
+                    if constexpr (std::is_nothrow_move_constructible_v<R>) {
+                        if (bEngaged) {
+                            std::invoke(Other.Destruct().Get(), Self->Resource().Get());
+                            Other.Release();
+                        }
                     }
-                }
-            });
+                    (void) Self, (void) bEngaged;
+                });
+                return std::tuple<TDestruct&&, decltype(Scope)>(std::move(Other.Destruct()), std::move(Scope));
+            }
         }
-    };
-
-    template <typename R, typename D>
-    struct UniqueResourceMove<R, D, true> : BaseUniqueResource<R, D> {
-        using Super = BaseUniqueResource<R, D>;
-        using Super::Super;
-
-        UniqueResourceMove() = default;
-
-        UniqueResourceMove(UniqueResourceMove&& Other) noexcept(Super::IsResourceMoveNoExcept()) :
-            Super(
-                std::forward_as_tuple(std::move(Other.Resource())),
-                std::forward_as_tuple(std::move(Other.Destruct())),
-                std::exchange(Other.bExecuteOnReset, false)) { }
 
-        UniqueResourceMove& operator=(UniqueResourceMove&&) = default;
+        TData Data;
     };
 
-    template <typename R, typename D, bool = BaseUniqueResource<R, D>::IsAssignable()>
-    struct UniqueResourceMoveAssign : UniqueResourceMove<R, D> {
-        using Super = UniqueResourceMove<R, D>;
+#if SCOPE_HAS_CONCEPTS
+    template <typename R, typename D, typename S>
+    using SelectUniqueResourceBase = BaseUniqueResource<R, D, S>;
+#else
+    template <typename R, typename D, typename S, bool = IsTriviallyDestructibleResource<R, D>>
+    struct UniqueResourceDestroy : BaseUniqueResource<R, D, S> {
+        using Super = BaseUniqueResource<R, D, S>;
         using Super::Super;
-    };
 
-    template <typename R, typename D>
-    struct UniqueResourceMoveAssign<R, D, true> : UniqueResourceMove<R, D> {
-        using Super = UniqueResourceMove<R, D>;
-        using Super::Super;
+        UniqueResourceDestroy() = default;
 
-        UniqueResourceMoveAssign() = default;
+        UniqueResourceDestroy(UniqueResourceDestroy&&) = default;
 
-        UniqueResourceMoveAssign(UniqueResourceMoveAssign&&) = default;
-
-        UniqueResourceMoveAssign& operator=(UniqueResourceMoveAssign&& Other) noexcept(Super::IsNoExceptAssignable()) {
-            constexpr auto IsResourceNoExceptAssignable = std::is_nothrow_move_assignable_v<typename Super::TResource>;
-            constexpr auto IsDestructNoExceptAssignable = std::is_nothrow_move_assignable_v<typename Super::TDestruct>;
+        UniqueResourceDestroy& operator=(UniqueResourceDestroy&&) = default;
 
+        ~UniqueResourceDestroy() {
             Super::Reset();
+        }
+    };
 
-            if constexpr (IsResourceNoExceptAssignable && !IsDestructNoExceptAssignable) {
-                Super::Destruct() = std::move(Other.Destruct());
-                Super::Resource() = std::move(Other.Resource());
-            } else {
-                Super::Resource() = std::move(Other.Resource());
-                Super::Destruct() = std::move(Other.Destruct());
-            }
-
-            Super::bExecuteOnReset = std::exchange(Other.bExecuteOnReset, false);
+    template <typename R, typename D, typename S>
+    struct UniqueResourceDestroy<R, D, S, true> : BaseUniqueResource<R, D, S> {
+        using Super = BaseUniqueResource<R, D, S>;
+        using Super::Super;
 
-            return *this;
-        }
+        UniqueResourceDestroy() = default;
     };
+
+    template <typename R, typename D, typename S>
+    using SelectUniqueResourceBase = UniqueResourceDestroy<R, D, S>;
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace stdx::details {
+    constexpr std::size_t BitsPerWord = 64;
+
+    inline std::size_t CountTrailingZeros(std::uint64_t Value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return std::size_t(__builtin_ctzll(Value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long Index;
+        _BitScanForward64(&Index, Value);
+        return std::size_t(Index);
+#else
+        std::size_t Count = 0;
+        while ((Value & 1) == 0) {
+            Value >>= 1;
+            ++Count;
+        }
+        return Count;
+#endif
+    }
+
+    template <typename F>
+    void ForEachRun(const std::uint64_t* Words, std::size_t Count, std::size_t Size, F&& Function) {
+        constexpr std::size_t None = ~std::size_t(0);
+
+        std::size_t Begin = None;
+        for (std::size_t Word = 0; Word < Count; ++Word) {
+            const std::uint64_t Bits = Words[Word];
+            const std::size_t Base = Word * BitsPerWord;
+
+            if (Begin == None ? Bits == 0 : ~Bits == 0) {
+                continue;
+            }
+
+            for (std::size_t Offset = 0; Offset < BitsPerWord;) {
+                const std::uint64_t Rest = (Begin == None ? Bits : ~Bits) >> Offset;
+                if (Rest == 0) {
+                    break;
+                }
+
+                Offset += CountTrailingZeros(Rest);
+                if (Begin == None) {
+                    Begin = Base + Offset;
+                } else {
+                    Function(Begin, Base + Offset);
+                    Begin = None;
+                }
+            }
+        }
+
+        if (Begin != None) {
+            Function(Begin, Size);
+        }
+    }
+}
\ No newline at end of file
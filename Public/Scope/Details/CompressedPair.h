@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Config.h"
+
+namespace stdx::details {
+    template <typename T>
+    constexpr bool IsEmptyBase = std::is_empty_v<T> && !std::is_final_v<T>;
+
+    template <std::size_t I, typename T, bool = IsEmptyBase<T>>
+    struct CompressedPairElement {
+        CompressedPairElement() = default;
+
+        template <typename... Ts, std::size_t... Is>
+        CompressedPairElement(std::tuple<Ts...>& Args, std::index_sequence<Is...>) noexcept(
+            std::is_nothrow_constructible_v<T, Ts...>) :
+            Value(std::forward<Ts>(std::get<Is>(Args))...) { }
+
+        SCOPE_FORCE_INLINE T& Get() noexcept {
+            return Value;
+        }
+
+        SCOPE_FORCE_INLINE const T& Get() const noexcept {
+            return Value;
+        }
+
+        T Value;
+    };
+
+    template <std::size_t I, typename T>
+    struct CompressedPairElement<I, T, true> : private T {
+        CompressedPairElement() = default;
+
+        template <typename... Ts, std::size_t... Is>
+        CompressedPairElement(std::tuple<Ts...>& Args, std::index_sequence<Is...>) noexcept(
+            std::is_nothrow_constructible_v<T, Ts...>) :
+            T(std::forward<Ts>(std::get<Is>(Args))...) { }
+
+        SCOPE_FORCE_INLINE T& Get() noexcept {
+            return *this;
+        }
+
+        SCOPE_FORCE_INLINE const T& Get() const noexcept {
+            return *this;
+        }
+    };
+
+    template <typename T1, typename T2>
+    struct CompressedPair : private CompressedPairElement<0, T1>, private CompressedPairElement<1, T2> {
+        using TFirst = CompressedPairElement<0, T1>;
+        using TSecond = CompressedPairElement<1, T2>;
+
+        CompressedPair() = default;
+
+        template <typename... Ts1, typename... Ts2>
+        CompressedPair(std::piecewise_construct_t, std::tuple<Ts1...> First, std::tuple<Ts2...> Second) noexcept(
+            std::is_nothrow_constructible_v<T1, Ts1...> && std::is_nothrow_constructible_v<T2, Ts2...>) :
+            TFirst(First, std::index_sequence_for<Ts1...>{}),
+            TSecond(Second, std::index_sequence_for<Ts2...>{}) { }
+
+        SCOPE_FORCE_INLINE T1& First() noexcept {
+            return TFirst::Get();
+        }
+
+        SCOPE_FORCE_INLINE const T1& First() const noexcept {
+            return TFirst::Get();
+        }
+
+        SCOPE_FORCE_INLINE T2& Second() noexcept {
+            return TSecond::Get();
+        }
+
+        SCOPE_FORCE_INLINE const T2& Second() const noexcept {
+            return TSecond::Get();
+        }
+    };
+}
\ No newline at end of file
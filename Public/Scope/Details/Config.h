@@ -0,0 +1,16 @@
+#pragma once
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define SCOPE_FORCE_INLINE __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+    #define SCOPE_FORCE_INLINE inline __attribute__((always_inline))
+#else
+    #define SCOPE_FORCE_INLINE inline
+#endif
+
+// Conditionally trivial special members (P0848) are what the requires-clause paths rely on.
+#if defined(__cpp_concepts) && __cpp_concepts >= 202002L
+    #define SCOPE_HAS_CONCEPTS 1
+#else
+    #define SCOPE_HAS_CONCEPTS 0
+#endif
\ No newline at end of file
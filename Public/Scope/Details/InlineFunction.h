@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace stdx::details {
+    struct ErasedOperations {
+        void (*Invoke)(void*);
+        void (*Move)(void*, void*);
+        void (*Destroy)(void*) noexcept;
+        std::size_t Size;
+        std::size_t Alignment;
+    };
+
+    template <typename T>
+    struct ErasedOperationsOf {
+        static_assert(std::is_invocable_v<T&>);
+        static_assert(std::is_nothrow_move_constructible_v<T> || std::is_copy_constructible_v<T>);
+
+        static void Invoke(void* Data) {
+            std::invoke(*static_cast<T*>(Data));
+        }
+
+        static void Move(void* To, void* From) {
+            ::new (To) T(std::move_if_noexcept(*static_cast<T*>(From)));
+        }
+
+        static void Destroy(void* Data) noexcept {
+            static_cast<T*>(Data)->~T();
+        }
+
+        static constexpr ErasedOperations Value{&Invoke, &Move, &Destroy, sizeof(T), alignof(T)};
+    };
+
+    template <std::size_t Size, std::size_t Alignment = alignof(std::max_align_t)>
+    class InlineFunction {
+    public:
+        template <typename T>
+        static constexpr bool Fits = sizeof(T) <= Size && Alignment % alignof(T) == 0;
+
+        InlineFunction() noexcept = default;
+
+        InlineFunction(InlineFunction&& Other) {
+            if (Other.Operations) {
+                Other.Operations->Move(Storage, Other.Storage);
+                Operations = Other.Operations;
+            }
+        }
+
+        InlineFunction(const InlineFunction&) = delete;
+
+        ~InlineFunction() {
+            Reset();
+        }
+
+        InlineFunction& operator=(const InlineFunction&) = delete;
+
+        InlineFunction& operator=(InlineFunction&&) = delete;
+
+        template <typename T, typename U>
+        void Emplace(U&& Value) {
+            static_assert(Fits<T>);
+
+            Reset();
+            ::new (static_cast<void*>(Storage)) T(std::forward<U>(Value));
+            Operations = &ErasedOperationsOf<T>::Value;
+        }
+
+        void Reset() noexcept {
+            if (Operations) {
+                std::exchange(Operations, nullptr)->Destroy(Storage);
+            }
+        }
+
+        void operator()() {
+            Operations->Invoke(Storage);
+        }
+
+        explicit operator bool() const noexcept {
+            return Operations != nullptr;
+        }
+
+    private:
+        alignas(Alignment) unsigned char Storage[Size];
+        const ErasedOperations* Operations = nullptr;
+    };
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <exception>
+#include <limits>
+#include <system_error>
 
 #include "ScopeBox.h"
 
@@ -64,4 +66,77 @@ namespace stdx::details {
 
         int UnchaughtOnCreation = std::uncaught_exceptions();
     };
+
+    template <typename TStatus>
+    constexpr bool IsSuccessStatus(const TStatus& Status) noexcept {
+        if constexpr (std::is_same_v<TStatus, std::error_code> || std::is_same_v<TStatus, std::error_condition>) {
+            return !Status;
+        } else {
+            return bool(Status);
+        }
+    }
+
+    template <typename T>
+    struct CommitPolicy : ScopeBox<T> {
+        using Super = ScopeBox<T>;
+        using Super::Super;
+
+        CommitPolicy(CommitPolicy&&) = default;
+
+        void Release() noexcept {
+            bExecuteOnDestruction = false;
+            bReleased = true;
+        }
+
+        void Commit() noexcept {
+            bExecuteOnDestruction = !bReleased;
+        }
+
+        template <typename TStatus>
+        void Commit(const TStatus& Status) noexcept {
+            if (IsSuccessStatus(Status)) {
+                Commit();
+            }
+        }
+
+        ~CommitPolicy() {
+            if (bExecuteOnDestruction) {
+                std::invoke(*this);
+            }
+        }
+
+        bool bExecuteOnDestruction = false;
+        bool bReleased = false;
+    };
+
+    template <typename T>
+    struct RollbackPolicy : ScopeBox<T> {
+        using Super = ScopeBox<T>;
+        using Super::Super;
+
+        RollbackPolicy(RollbackPolicy&&) = default;
+
+        void Release() noexcept {
+            bExecuteOnDestruction = false;
+        }
+
+        void Commit() noexcept {
+            bExecuteOnDestruction = false;
+        }
+
+        template <typename TStatus>
+        void Commit(const TStatus& Status) noexcept {
+            if (IsSuccessStatus(Status)) {
+                Commit();
+            }
+        }
+
+        ~RollbackPolicy() {
+            if (bExecuteOnDestruction) {
+                std::invoke(*this);
+            }
+        }
+
+        bool bExecuteOnDestruction = true;
+    };
 }
\ No newline at end of file
@@ -2,131 +2,109 @@
 
 #include <Scope/Scope.h>
 
+#include "CompressedPair.h"
+
 namespace stdx::details {
-    template <typename T>
-    struct BaseResourceBox {
-        using Type = TypeIdentity<T>;
+    template <typename T, bool = IsEmptyBase<T>>
+    struct ResourceStorage {
+        template <typename... U>
+        explicit ResourceStorage(std::in_place_t, U&&... Value) noexcept(std::is_nothrow_constructible_v<T, U...>) :
+            Value(std::forward<U>(Value)...) { }
 
-        template <typename U>
-        static U& GetRef(U& Value) noexcept {
+        SCOPE_FORCE_INLINE T& Data() noexcept {
             return Value;
         }
 
-        template <typename U>
-        static U& GetRef(std::reference_wrapper<U> Value) noexcept {
-            return Value.get();
+        SCOPE_FORCE_INLINE const T& Data() const noexcept {
+            return Value;
         }
 
-        template <typename U = T, typename std::enable_if_t<std::is_default_constructible_v<U>, int> = 0>
-        BaseResourceBox() noexcept(std::is_nothrow_default_constructible_v<T>) : Data() { }
+        T Value;
+    };
 
-        template <typename U, typename std::enable_if_t<std::is_constructible_v<T, U>, int> = 0>
-        explicit BaseResourceBox(std::in_place_t, U&& Data) noexcept(std::is_nothrow_constructible_v<T, U>) :
-            Data(std::forward<U>(Data)) { }
+    template <typename T>
+    struct ResourceStorage<T, true> : private T {
+        template <typename... U>
+        explicit ResourceStorage(std::in_place_t, U&&... Value) noexcept(std::is_nothrow_constructible_v<T, U...>) :
+            T(std::forward<U>(Value)...) { }
 
-        template <typename U, typename F, typename std::enable_if_t<std::is_constructible_v<T, U>, int> = 0>
-        explicit BaseResourceBox(std::in_place_t, U&& Data, ScopeExit<F>&& Scope) noexcept(
-            std::is_nothrow_constructible_v<T, U>) :
-            Data(std::forward<U>(Data)) {
-            Scope.Release();
+        SCOPE_FORCE_INLINE T& Data() noexcept {
+            return *this;
         }
 
-        BaseResourceBox(const BaseResourceBox&) = delete;
-
-        BaseResourceBox(BaseResourceBox&& Other) = delete;
-
-        BaseResourceBox& operator=(const BaseResourceBox&) = delete;
-
-        BaseResourceBox& operator=(BaseResourceBox&&) = delete;
-
-        decltype(auto) Get() const noexcept {
-            return GetRef(Data);
+        SCOPE_FORCE_INLINE const T& Data() const noexcept {
+            return *this;
         }
-
-        Type Data;
-    };
-
-    template <typename T, bool = std::is_nothrow_move_constructible_v<T>>
-    struct ResourceBoxMove : BaseResourceBox<T> {
-        using Super = BaseResourceBox<T>;
-        using Super::Super;
-
-        ResourceBoxMove() = default;
-
-        ResourceBoxMove(ResourceBoxMove&& Other) noexcept(std::is_nothrow_copy_constructible_v<T>) :
-            Super(std::in_place, std::as_const(Other.Data)) { }
-
-        template <typename F>
-        ResourceBoxMove(ResourceBoxMove&& Other, ScopeExit<F>&& Scope) noexcept(std::is_nothrow_copy_constructible_v<T>) :
-            Super(std::in_place, std::as_const(Other.Data), std::move(Scope)) { }
     };
 
     template <typename T>
-    struct ResourceBoxMove<T, true> : BaseResourceBox<T> {
-        using Super = BaseResourceBox<T>;
-        using Super::Super;
-
-        ResourceBoxMove() = default;
+    struct BasicResourceBox : ResourceStorage<T> {
+        using Storage = ResourceStorage<T>;
+        using Type = TypeIdentity<T>;
 
-        ResourceBoxMove(ResourceBoxMove&& Other) noexcept : Super(std::in_place, std::move(Other.Data)) { }
-    };
+        static_assert(std::is_destructible_v<Type>);
 
-    template <typename T, bool = std::is_nothrow_move_assignable_v<T>>
-    struct ResourceBoxMoveAssign : ResourceBoxMove<T> {
-        using Super = ResourceBoxMove<T>;
-        using Super::Super;
+        static constexpr bool IsMoveConstructible = std::is_nothrow_move_constructible_v<T> || std::is_copy_constructible_v<T>;
+        static constexpr bool IsMoveAssignable = std::is_nothrow_move_assignable_v<T> || std::is_copy_assignable_v<T>;
 
-        ResourceBoxMoveAssign() = default;
+        template <typename U = T, typename std::enable_if_t<std::is_default_constructible_v<U>, int> = 0>
+        BasicResourceBox() noexcept(std::is_nothrow_default_constructible_v<T>) : Storage(std::in_place) { }
 
-        ResourceBoxMoveAssign(ResourceBoxMoveAssign&&) = default;
+        template <typename... U, typename std::enable_if_t<std::is_constructible_v<T, U...>, int> = 0>
+        explicit BasicResourceBox(std::in_place_t, U&&... Value) noexcept(std::is_nothrow_constructible_v<T, U...>) :
+            Storage(std::in_place, std::forward<U>(Value)...) { }
 
-        ResourceBoxMoveAssign& operator=(ResourceBoxMoveAssign&& Other) noexcept(std::is_nothrow_copy_assignable_v<T>) {
-            Super::Data = std::as_const(Other.Data);
-            return *this;
+        template <typename U, typename F, typename std::enable_if_t<std::is_constructible_v<T, U>, int> = 0>
+        explicit BasicResourceBox(std::in_place_t, U&& Value, ScopeExit<F>&& Scope) noexcept(
+            std::is_nothrow_constructible_v<T, U>) :
+            Storage(std::in_place, std::forward<U>(Value)) {
+            Scope.Release();
         }
-    };
-
-    template <typename T>
-    struct ResourceBoxMoveAssign<T, true> : ResourceBoxMove<T> {
-        using Super = ResourceBoxMove<T>;
-        using Super::Super;
 
-        ResourceBoxMoveAssign() = default;
+        BasicResourceBox(const BasicResourceBox&) = delete;
 
-        ResourceBoxMoveAssign(ResourceBoxMoveAssign&&) = default;
+#if SCOPE_HAS_CONCEPTS
+        BasicResourceBox(BasicResourceBox&& Other) noexcept(
+            std::is_nothrow_constructible_v<T, MoveIfNoExceptType<T>>) requires IsMoveConstructible :
+#else
+        BasicResourceBox(std::conditional_t<IsMoveConstructible, BasicResourceBox, Nonesuch>&& Other) noexcept(
+            std::is_nothrow_constructible_v<T, MoveIfNoExceptType<T>>) :
+#endif
+            Storage(std::in_place, MoveIfNoExcept(Other.Data())) { }
 
-        ResourceBoxMoveAssign& operator=(ResourceBoxMoveAssign&& Other) noexcept {
-            Super::Data = std::move(Other.Data);
+        template <typename F>
+        BasicResourceBox(BasicResourceBox&& Other, ScopeExit<F>&& Scope) noexcept(
+            std::is_nothrow_constructible_v<T, MoveIfNoExceptType<T>>) :
+            BasicResourceBox(std::in_place, MoveIfNoExcept(Other.Data()), std::move(Scope)) { }
+
+        BasicResourceBox& operator=(const BasicResourceBox&) = delete;
+
+#if SCOPE_HAS_CONCEPTS
+        BasicResourceBox& operator=(BasicResourceBox&& Other) noexcept(
+            std::is_nothrow_assignable_v<T&, MoveAssignIfNoExceptType<T>>) requires IsMoveAssignable {
+#else
+        BasicResourceBox& operator=(std::conditional_t<IsMoveAssignable, BasicResourceBox, Nonesuch>&& Other) noexcept(
+            std::is_nothrow_assignable_v<T&, MoveAssignIfNoExceptType<T>>) {
+#endif
+            Storage::Data() = MoveAssignIfNoExcept(Other.Data());
             return *this;
         }
-    };
-
-    template <typename T>
-    using SelectBaseMoveAssign = std::conditional_t<
-        std::is_nothrow_move_assignable_v<T> || std::is_copy_assignable_v<T>,
-        ResourceBoxMoveAssign<T>,
-        ResourceBoxMove<T>>;
-
-    template <typename T>
-    struct ResourceBox : SelectBaseMoveAssign<std::decay_t<T>> {
-        using Super = SelectBaseMoveAssign<std::decay_t<T>>;
-        using Super::Super;
-        using typename Super::Type;
-
-        static_assert(std::is_nothrow_move_constructible_v<Type> || std::is_copy_constructible_v<Type>);
-        static_assert(std::is_destructible_v<Type>);
 
         template <typename U, typename std::enable_if_t<std::is_assignable_v<Type&, U>, int> = 0>
-        ResourceBox& operator=(U&& Value) noexcept(std::is_nothrow_assignable_v<Type&, U>) {
-            Super::Data = std::forward<U>(Value);
+        BasicResourceBox& operator=(U&& Value) noexcept(std::is_nothrow_assignable_v<Type&, U>) {
+            Storage::Data() = std::forward<U>(Value);
             return *this;
         }
+
+        SCOPE_FORCE_INLINE decltype(auto) Get() const noexcept {
+            if constexpr (IsReferenceWrapper<T>) {
+                return Storage::Data().get();
+            } else {
+                return Storage::Data();
+            }
+        }
     };
 
     template <typename T>
-    struct ResourceBox<T&> : ResourceBox<std::reference_wrapper<T>> {
-        using Super = ResourceBox<std::reference_wrapper<T>>;
-        using Super::Super;
-        using Super::operator=;
-    };
+    using ResourceBox = BasicResourceBox<BoxedType<T>>;
 }
\ No newline at end of file
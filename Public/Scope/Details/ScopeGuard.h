@@ -1,12 +1,21 @@
 #pragma once
 
+#include <type_traits>
 #include <utility>
 
+#include "Traits.h"
+
 namespace stdx::details {
     template <typename TPolicy>
-    class ScopeGuard : private TPolicy {
+    class ScopeGuard : protected TPolicy {
     public:
-        ScopeGuard(ScopeGuard&& Other) noexcept(std::is_nothrow_move_constructible_v<TPolicy>) : TPolicy(std::move(Other)) {
+#if SCOPE_HAS_CONCEPTS
+        ScopeGuard(ScopeGuard&& Other) noexcept(std::is_nothrow_move_constructible_v<TPolicy>) requires
+            std::is_move_constructible_v<TPolicy> : TPolicy(std::move(Other)) {
+#else
+        ScopeGuard(std::conditional_t<std::is_move_constructible_v<TPolicy>, ScopeGuard, Nonesuch>&& Other) noexcept(
+            std::is_nothrow_move_constructible_v<TPolicy>) : TPolicy(std::move(Other)) {
+#endif
             Other.Release();
         }
 
@@ -2,10 +2,21 @@
 
 #include <functional>
 #include <type_traits>
+#include <utility>
+
+#include "Config.h"
 
 namespace stdx {
     template <typename T>
     class ScopeExit;
+
+    struct NoopDeleter;
+
+    template <typename T>
+    struct IsTriviallyRelocatable : std::is_trivially_copyable<T> { };
+
+    template <typename T>
+    constexpr bool IsTriviallyRelocatableV = IsTriviallyRelocatable<T>::value;
 }
 
 namespace stdx::details {
@@ -20,6 +31,58 @@ namespace stdx::details {
     template <typename... Ts>
     struct TypePack { };
 
+    struct Nonesuch {
+        Nonesuch() = delete;
+    };
+
+    template <typename T>
+    struct Boxed {
+        using Type = std::decay_t<T>;
+    };
+
+    template <typename T>
+    struct Boxed<T&> {
+        using Type = std::reference_wrapper<T>;
+    };
+
+    template <typename T>
+    using BoxedType = typename Boxed<T>::Type;
+
+    template <typename T>
+    constexpr bool IsReferenceWrapper = false;
+
+    template <typename T>
+    constexpr bool IsReferenceWrapper<std::reference_wrapper<T>> = true;
+
+    template <typename T>
+    struct UnwrapReference {
+        using Type = T;
+    };
+
+    template <typename T>
+    struct UnwrapReference<std::reference_wrapper<T>> {
+        using Type = T;
+    };
+
+    template <typename T>
+    using UnwrapReferenceType = typename UnwrapReference<T>::Type;
+
+    template <typename T>
+    using MoveIfNoExceptType = std::conditional_t<std::is_nothrow_move_constructible_v<T>, T&&, const T&>;
+
+    template <typename T>
+    SCOPE_FORCE_INLINE MoveIfNoExceptType<T> MoveIfNoExcept(T& Value) noexcept {
+        return std::move(Value);
+    }
+
+    template <typename T>
+    using MoveAssignIfNoExceptType = std::conditional_t<std::is_nothrow_move_assignable_v<T>, T&&, const T&>;
+
+    template <typename T>
+    SCOPE_FORCE_INLINE MoveAssignIfNoExceptType<T> MoveAssignIfNoExcept(T& Value) noexcept {
+        return std::move(Value);
+    }
+
     template <typename Base, typename U, bool = std::is_nothrow_constructible_v<Base, std::in_place_t, U>>
     struct ScopeConstructible {
         using Type = decltype(std::as_const(std::declval<U&>()));
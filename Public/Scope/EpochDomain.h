@@ -0,0 +1,280 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+    #include <linux/membarrier.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+#include "Scope.h"
+
+namespace stdx {
+    namespace details {
+#if defined(__linux__) && defined(__NR_membarrier)
+        inline bool RegisterHeavyFence() noexcept {
+            const long Commands = ::syscall(__NR_membarrier, MEMBARRIER_CMD_QUERY, 0, 0);
+            if (Commands < 0 || !(Commands & MEMBARRIER_CMD_PRIVATE_EXPEDITED)) {
+                return false;
+            }
+            return ::syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0;
+        }
+
+        inline bool RunHeavyFence() noexcept {
+            return ::syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0) == 0;
+        }
+#else
+        inline bool RegisterHeavyFence() noexcept {
+            return false;
+        }
+
+        inline bool RunHeavyFence() noexcept {
+            return false;
+        }
+#endif
+
+        inline bool HasHeavyFence() noexcept {
+            static const bool Value = RegisterHeavyFence();
+            return Value;
+        }
+
+        // Reader side of an asymmetric fence: only a compiler barrier when the writer can interrupt every thread instead.
+        inline void LightFence() noexcept {
+            if (HasHeavyFence()) {
+                std::atomic_signal_fence(std::memory_order_seq_cst);
+            } else {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+
+        inline void HeavyFence() noexcept {
+            if (!HasHeavyFence() || !RunHeavyFence()) {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+
+        struct RetiredNode {
+            RetiredNode* Next;
+            std::uint64_t Epoch;
+            void (*Destroy)(RetiredNode*) noexcept;
+        };
+
+        template <typename T>
+        struct RetiredValue : RetiredNode {
+            explicit RetiredValue(T&& Value) noexcept(std::is_nothrow_move_constructible_v<T>) : RetiredNode{nullptr, 0, &Delete}, Value(std::move(Value)) { }
+
+            static void Delete(RetiredNode* Node) noexcept {
+                delete static_cast<RetiredValue*>(Node);
+            }
+
+            T Value;
+        };
+    }
+
+    class EpochDomain {
+    public:
+        class Guard;
+        class Participant;
+
+        explicit EpochDomain(std::size_t BatchSize = 64) noexcept : BatchSize(BatchSize) { }
+
+        EpochDomain(const EpochDomain&) = delete;
+
+        EpochDomain(EpochDomain&&) = delete;
+
+        ~EpochDomain() {
+            Free(std::exchange(Orphans, nullptr), nullptr);
+        }
+
+        EpochDomain& operator=(const EpochDomain&) = delete;
+
+        EpochDomain& operator=(EpochDomain&&) = delete;
+
+        [[nodiscard]] std::uint64_t GetEpoch() const noexcept {
+            return Epoch.load(std::memory_order_acquire);
+        }
+
+    private:
+        static std::size_t
+            Free(details::RetiredNode* Node, details::RetiredNode** Kept, std::uint64_t Safe = ~std::uint64_t(0)) noexcept;
+
+        bool TryAdvance() noexcept;
+
+        std::atomic<std::uint64_t> Epoch = 2;
+        std::mutex Mutex;
+        Participant* Participants = nullptr;
+        details::RetiredNode* Orphans = nullptr;
+        const std::size_t BatchSize;
+    };
+
+    class EpochDomain::Participant {
+        static constexpr std::uint64_t Active = 1;
+
+    public:
+        explicit Participant(EpochDomain& Domain) : Domain(Domain) {
+            std::lock_guard Lock(Domain.Mutex);
+            Next = std::exchange(Domain.Participants, this);
+        }
+
+        Participant(const Participant&) = delete;
+
+        Participant(Participant&&) = delete;
+
+        ~Participant() {
+            Collect();
+
+            std::lock_guard Lock(Domain.Mutex);
+            for (Participant** Link = &Domain.Participants; *Link; Link = &(*Link)->Next) {
+                if (*Link == this) {
+                    *Link = Next;
+                    break;
+                }
+            }
+
+            while (Retired) {
+                details::RetiredNode* Node = std::exchange(Retired, Retired->Next);
+                Node->Next = std::exchange(Domain.Orphans, Node);
+            }
+        }
+
+        Participant& operator=(const Participant&) = delete;
+
+        Participant& operator=(Participant&&) = delete;
+
+        [[nodiscard]] Guard Enter() noexcept;
+
+        template <typename T, typename std::enable_if_t<!std::is_lvalue_reference_v<T>, int> = 0>
+        void Retire(T&& Value) {
+            RetireNode(new details::RetiredValue<std::decay_t<T>>(std::move(Value)));
+        }
+
+        void RetireNode(details::RetiredNode* Node) noexcept {
+            Node->Epoch = Domain.Epoch.load(std::memory_order_acquire);
+            Node->Next = std::exchange(Retired, Node);
+
+            if (++RetiredCount >= Domain.BatchSize) {
+                Collect();
+            }
+        }
+
+        void Collect() noexcept {
+            details::RetiredNode* Orphans = nullptr;
+            {
+                std::lock_guard Lock(Domain.Mutex);
+                Domain.TryAdvance();
+                Orphans = std::exchange(Domain.Orphans, nullptr);
+            }
+
+            while (Orphans) {
+                details::RetiredNode* Node = std::exchange(Orphans, Orphans->Next);
+                Node->Next = std::exchange(Retired, Node);
+                ++RetiredCount;
+            }
+
+            const std::uint64_t Current = Domain.Epoch.load(std::memory_order_acquire);
+            RetiredCount = EpochDomain::Free(std::exchange(Retired, nullptr), &Retired, Current - 2);
+        }
+
+        // Waiting inside this participant's own Enter() scope would never finish, so that returns false instead.
+        bool Synchronize() noexcept {
+            if (Nesting != 0) {
+                return false;
+            }
+            while (Retired) {
+                Collect();
+                if (Retired) {
+                    std::this_thread::yield();
+                }
+            }
+            return true;
+        }
+
+        [[nodiscard]] std::size_t GetRetired() const noexcept {
+            return RetiredCount;
+        }
+
+    private:
+        friend class EpochDomain;
+        friend class Guard;
+
+        void Leave() noexcept {
+            if (--Nesting == 0) {
+                State.store(0, std::memory_order_release);
+            }
+        }
+
+        EpochDomain& Domain;
+        Participant* Next = nullptr;
+        std::atomic<std::uint64_t> State = 0;
+        std::size_t Nesting = 0;
+        details::RetiredNode* Retired = nullptr;
+        std::size_t RetiredCount = 0;
+    };
+
+    class EpochDomain::Guard {
+    public:
+        Guard(const Guard&) = delete;
+
+        Guard(Guard&&) = delete;
+
+        ~Guard() {
+            Owner.Leave();
+        }
+
+        Guard& operator=(const Guard&) = delete;
+
+        Guard& operator=(Guard&&) = delete;
+
+    private:
+        friend class Participant;
+
+        explicit Guard(Participant& Owner) noexcept : Owner(Owner) {
+            if (Owner.Nesting++ == 0) {
+                Owner.State.store(
+                    Owner.Domain.Epoch.load(std::memory_order_relaxed) << 1 | Participant::Active, std::memory_order_relaxed);
+                details::LightFence();
+            }
+        }
+
+        Participant& Owner;
+    };
+
+    inline EpochDomain::Guard EpochDomain::Participant::Enter() noexcept {
+        return Guard(*this);
+    }
+
+    inline std::size_t EpochDomain::Free(details::RetiredNode* Node, details::RetiredNode** Kept, std::uint64_t Safe) noexcept {
+        std::size_t Count = 0;
+        while (Node) {
+            details::RetiredNode* Next = std::exchange(Node->Next, nullptr);
+            if (Node->Epoch <= Safe) {
+                Node->Destroy(Node);
+            } else {
+                Node->Next = std::exchange(*Kept, Node);
+                ++Count;
+            }
+            Node = Next;
+        }
+        return Count;
+    }
+
+    inline bool EpochDomain::TryAdvance() noexcept {
+        details::HeavyFence();
+
+        std::uint64_t Current = Epoch.load(std::memory_order_relaxed);
+        for (Participant* Value = Participants; Value; Value = Value->Next) {
+            const std::uint64_t State = Value->State.load(std::memory_order_acquire);
+            if ((State & Participant::Active) && (State >> 1) != Current) {
+                return false;
+            }
+        }
+        return Epoch.compare_exchange_strong(Current, Current + 1, std::memory_order_acq_rel);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include "UniqueHandle.h"
+
+namespace stdx {
+    namespace details {
+        constexpr std::size_t MaxFdsPerMessage = 253;
+
+        union ControlBuffer {
+            alignas(::cmsghdr) unsigned char Data[CMSG_SPACE(sizeof(int) * MaxFdsPerMessage)];
+            ::cmsghdr Header;
+        };
+    }
+
+    [[nodiscard]] inline ::ssize_t SendFds(int Socket, UniqueFd* Fds, std::size_t Count) noexcept {
+        std::size_t Sent = 0;
+        while (Sent < Count) {
+            const std::size_t Batch = std::min(Count - Sent, details::MaxFdsPerMessage);
+
+            char Byte = 0;
+            ::iovec Vector{&Byte, 1};
+
+            details::ControlBuffer Control;
+            std::memset(&Control, 0, sizeof(Control));
+
+            ::msghdr Message{};
+            Message.msg_iov = &Vector;
+            Message.msg_iovlen = 1;
+            Message.msg_control = Control.Data;
+            Message.msg_controllen = CMSG_SPACE(sizeof(int) * Batch);
+
+            ::cmsghdr* Header = CMSG_FIRSTHDR(&Message);
+            Header->cmsg_level = SOL_SOCKET;
+            Header->cmsg_type = SCM_RIGHTS;
+            Header->cmsg_len = CMSG_LEN(sizeof(int) * Batch);
+
+            auto* Data = reinterpret_cast<int*>(CMSG_DATA(Header));
+            for (std::size_t Index = 0; Index < Batch; ++Index) {
+                const int Fd = Fds[Sent + Index].Get();
+                std::memcpy(Data + Index, &Fd, sizeof(int));
+            }
+
+            ::ssize_t Result;
+            do {
+                Result = ::sendmsg(Socket, &Message, MSG_NOSIGNAL);
+            } while (Result == -1 && errno == EINTR);
+
+            if (Result != 1) {
+                return Sent ? ::ssize_t(Sent) : -1;
+            }
+
+            for (std::size_t Index = 0; Index < Batch; ++Index) {
+                Fds[Sent + Index].Reset();
+            }
+            Sent += Batch;
+        }
+        return ::ssize_t(Sent);
+    }
+
+    [[nodiscard]] inline bool SendFd(int Socket, UniqueFd& Fd) noexcept {
+        return SendFds(Socket, &Fd, 1) == 1;
+    }
+
+    [[nodiscard]] inline ::ssize_t ReceiveFds(int Socket, UniqueFd* Fds, std::size_t Capacity) noexcept {
+        const std::size_t Batch = std::min(Capacity, details::MaxFdsPerMessage);
+
+        char Byte;
+        ::iovec Vector{&Byte, 1};
+
+        details::ControlBuffer Control;
+        ::msghdr Message{};
+        Message.msg_iov = &Vector;
+        Message.msg_iovlen = 1;
+        Message.msg_control = Control.Data;
+        Message.msg_controllen = CMSG_SPACE(sizeof(int) * Batch);
+
+        int Flags = 0;
+#if defined(MSG_CMSG_CLOEXEC)
+        Flags |= MSG_CMSG_CLOEXEC;
+#endif
+
+        ::ssize_t Result;
+        do {
+            Result = ::recvmsg(Socket, &Message, Flags);
+        } while (Result == -1 && errno == EINTR);
+
+        if (Result <= 0) {
+            return Result;
+        }
+
+        std::size_t Received = 0;
+        for (::cmsghdr* Header = CMSG_FIRSTHDR(&Message); Header; Header = CMSG_NXTHDR(&Message, Header)) {
+            if (Header->cmsg_level != SOL_SOCKET || Header->cmsg_type != SCM_RIGHTS) {
+                continue;
+            }
+
+            const std::size_t Count = (Header->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+            const auto* Data = reinterpret_cast<const unsigned char*>(CMSG_DATA(Header));
+            for (std::size_t Index = 0; Index < Count; ++Index) {
+                int Fd;
+                std::memcpy(&Fd, Data + Index * sizeof(int), sizeof(int));
+                if (Received < Capacity) {
+                    Fds[Received++] = UniqueFd(Fd);
+                } else {
+                    UniqueFd Discard(Fd);
+                }
+            }
+        }
+
+        if (Message.msg_flags & MSG_CTRUNC) {
+            errno = EMSGSIZE;
+            return -1;
+        }
+        return ::ssize_t(Received);
+    }
+
+    [[nodiscard]] inline UniqueFd ReceiveFd(int Socket) noexcept {
+        UniqueFd Fd;
+        (void) ReceiveFds(Socket, &Fd, 1);
+        return Fd;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <utility>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "UniqueMapping.h"
+
+namespace stdx {
+    enum class GrowPolicy { Fixed, MayMove };
+
+    template <GrowPolicy Policy = GrowPolicy::Fixed>
+    class GrowableMapping {
+#if !defined(__linux__)
+        static_assert(Policy == GrowPolicy::Fixed, "GrowPolicy::MayMove requires mremap");
+#endif
+
+    public:
+        GrowableMapping() noexcept = default;
+
+        GrowableMapping(GrowableMapping&& Other) noexcept :
+            Region(std::move(Other.Region)),
+            Committed(std::exchange(Other.Committed, 0)) { }
+
+        GrowableMapping& operator=(GrowableMapping&& Other) noexcept {
+            Region = std::move(Other.Region);
+            Committed = std::exchange(Other.Committed, 0);
+            return *this;
+        }
+
+        [[nodiscard]] static GrowableMapping Reserve(std::size_t Capacity, std::size_t Size = 0) noexcept {
+            GrowableMapping Result;
+            if constexpr (Policy == GrowPolicy::Fixed) {
+                Capacity = details::AlignUp(Capacity, GetPageSize());
+                void* Address = ::mmap(nullptr, Capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+                if (Address == MAP_FAILED) {
+                    return Result;
+                }
+                Result.Region.Reset(Mapping{Address, Capacity});
+            } else {
+                const std::size_t Length = details::AlignUp(Size, GetPageSize());
+                Result.Region = MapAnonymous(std::max(Length, GetPageSize()));
+                if (!Result.Region.IsEngaged()) {
+                    return Result;
+                }
+                Result.Committed = Length;
+            }
+
+            if (Size > Result.Committed && !Result.Grow(Size)) {
+                Result.Region.Reset();
+            }
+            return Result;
+        }
+
+        bool Grow(std::size_t Size) noexcept {
+            if (Size <= Committed) {
+                return true;
+            }
+            if (!Region.IsEngaged()) {
+                errno = EINVAL;
+                return false;
+            }
+
+            const std::size_t Target = details::AlignUp(std::max(Size, 2 * Committed), GetPageSize());
+            const Mapping Current = Region.Get();
+
+            if constexpr (Policy == GrowPolicy::Fixed) {
+                if (Size > Current.Length) {
+                    errno = ENOMEM;
+                    return false;
+                }
+
+                const std::size_t Length = std::min(Target, Current.Length);
+                if (::mprotect(Current.Data() + Committed, Length - Committed, PROT_READ | PROT_WRITE) != 0) {
+                    return false;
+                }
+                Committed = Length;
+            } else {
+#if defined(__linux__)
+                if (Target > Current.Length) {
+                    void* Address = ::mremap(Current.Address, Current.Length, Target, MREMAP_MAYMOVE);
+                    if (Address == MAP_FAILED) {
+                        return false;
+                    }
+                    Region.Release();
+                    Region.Reset(Mapping{Address, Target});
+                }
+                Committed = Target;
+#endif
+            }
+            return true;
+        }
+
+        [[nodiscard]] std::byte* Data() const noexcept {
+            return Region.IsEngaged() ? Region.Get().Data() : nullptr;
+        }
+
+        [[nodiscard]] std::size_t GetSize() const noexcept {
+            return Committed;
+        }
+
+        [[nodiscard]] std::size_t GetCapacity() const noexcept {
+            return Region.IsEngaged() ? Region.Get().Length : 0;
+        }
+
+        [[nodiscard]] bool IsEngaged() const noexcept {
+            return Region.IsEngaged();
+        }
+
+        [[nodiscard]] const UniqueMapping& Get() const noexcept {
+            return Region;
+        }
+
+    private:
+        static std::size_t GetPageSize() noexcept {
+            static const auto PageSize = std::size_t(::sysconf(_SC_PAGESIZE));
+            return PageSize;
+        }
+
+        UniqueMapping Region;
+        std::size_t Committed = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "Details/ResourceBox.h"
+#include "UniqueResource.h"
+
+namespace stdx {
+    template <typename R, typename D, typename S = void, typename F = R (*)()>
+    class LazyUniqueResource {
+        using TDestruct = details::ResourceBox<D>;
+        using TResource = UniqueResource<R, D, S>;
+
+        static_assert(std::is_invocable_v<F&>);
+
+    public:
+        template <
+            typename F2,
+            typename D2,
+            typename std::enable_if_t<
+                std::is_constructible_v<F, F2> && std::is_constructible_v<TDestruct, std::in_place_t, D2>,
+                int> = 0>
+        LazyUniqueResource(F2&& Factory, D2&& Destruct) noexcept(
+            std::is_nothrow_constructible_v<F, F2> && std::is_nothrow_constructible_v<TDestruct, std::in_place_t, D2>) :
+            Factory(std::forward<F2>(Factory)),
+            Destruct(std::in_place, std::forward<D2>(Destruct)) { }
+
+        template <
+            typename F2,
+            typename T = TDestruct,
+            typename std::enable_if_t<std::is_constructible_v<F, F2> && std::is_default_constructible_v<T>, int> = 0>
+        explicit LazyUniqueResource(F2&& Factory) noexcept(
+            std::is_nothrow_constructible_v<F, F2> && std::is_nothrow_default_constructible_v<T>) :
+            Factory(std::forward<F2>(Factory)) { }
+
+        LazyUniqueResource(const LazyUniqueResource&) = delete;
+
+        LazyUniqueResource(LazyUniqueResource&&) = delete;
+
+        LazyUniqueResource& operator=(const LazyUniqueResource&) = delete;
+
+        LazyUniqueResource& operator=(LazyUniqueResource&&) = delete;
+
+        [[nodiscard]] decltype(auto) Get() {
+            if (!bAcquired.load(std::memory_order_acquire)) {
+                return Acquire();
+            }
+            return Resource->Get();
+        }
+
+        [[nodiscard]] decltype(auto) GetDeleter() const noexcept {
+            return Destruct.Get();
+        }
+
+        [[nodiscard]] bool IsAcquired() const noexcept {
+            return bAcquired.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] bool IsEngaged() const noexcept {
+            return IsAcquired() && Resource->IsEngaged();
+        }
+
+        // Release() and Reset() serialize with a concurrent first Get(), but Get() does not lock once acquired:
+        // they must not overlap with other threads still calling Get() or using a value it returned.
+        void Release() noexcept {
+            std::lock_guard Lock(Mutex);
+            if (bAcquired.load(std::memory_order_relaxed)) {
+                Resource->Release();
+            }
+        }
+
+        void Reset() noexcept {
+            std::lock_guard Lock(Mutex);
+            if (bAcquired.load(std::memory_order_relaxed)) {
+                bAcquired.store(false, std::memory_order_release);
+                Resource.reset();
+            }
+        }
+
+    private:
+        decltype(auto) Acquire() {
+            std::lock_guard Lock(Mutex);
+            if (!bAcquired.load(std::memory_order_relaxed)) {
+                Resource.emplace(std::invoke(Factory), std::as_const(Destruct).Get());
+                bAcquired.store(true, std::memory_order_release);
+            }
+            return Resource->Get();
+        }
+
+        std::atomic<bool> bAcquired = false;
+        std::mutex Mutex;
+        F Factory;
+        TDestruct Destruct;
+        std::optional<TResource> Resource;
+    };
+
+    template <typename F, typename D>
+    LazyUniqueResource(F, D)->LazyUniqueResource<std::decay_t<std::invoke_result_t<F&>>, D, void, F>;
+}
\ No newline at end of file
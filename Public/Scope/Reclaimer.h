@@ -0,0 +1,208 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "Details/InlineFunction.h"
+#include "Details/Traits.h"
+
+namespace stdx {
+    template <std::size_t Capacity = 1024, std::size_t Size = 4 * sizeof(void*)>
+    class BasicReclaimer {
+        using TFunction = details::InlineFunction<Size>;
+
+        static_assert(Capacity > 0);
+
+        struct Cell {
+            std::atomic<std::size_t> Sequence;
+            TFunction Function;
+        };
+
+        static constexpr std::size_t CacheLine = 64;
+
+    public:
+        BasicReclaimer() : Cells(std::make_unique<Cell[]>(Capacity)) {
+            for (std::size_t Index = 0; Index < Capacity; ++Index) {
+                Cells[Index].Sequence.store(Index, std::memory_order_relaxed);
+            }
+            Worker = std::thread([this]() { Run(); });
+        }
+
+        BasicReclaimer(const BasicReclaimer&) = delete;
+
+        BasicReclaimer(BasicReclaimer&&) = delete;
+
+        ~BasicReclaimer() {
+            {
+                std::lock_guard Lock(Mutex);
+                bStop = true;
+            }
+            WakeCondition.notify_one();
+            Worker.join();
+        }
+
+        BasicReclaimer& operator=(const BasicReclaimer&) = delete;
+
+        BasicReclaimer& operator=(BasicReclaimer&&) = delete;
+
+        template <typename U, typename F = std::decay_t<U>, typename std::enable_if_t<std::is_invocable_v<F&>, int> = 0>
+        void Defer(U&& Function) noexcept(std::is_nothrow_constructible_v<F, U>) {
+            static_assert(TFunction::template Fits<F>, "Callable does not fit into the inline storage");
+
+            std::size_t Position = Head.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& Value = Cells[Position % Capacity];
+                const auto Difference =
+                    std::ptrdiff_t(Value.Sequence.load(std::memory_order_acquire)) - std::ptrdiff_t(Position);
+                if (Difference == 0) {
+                    if (Head.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (Difference < 0) {
+                    std::invoke(Function);
+                    return;
+                } else {
+                    Position = Head.load(std::memory_order_relaxed);
+                }
+            }
+
+            Cell& Value = Cells[Position % Capacity];
+            if constexpr (std::is_nothrow_constructible_v<F, U>) {
+                Value.Function.template Emplace<F>(std::forward<U>(Function));
+            } else {
+                try {
+                    Value.Function.template Emplace<F>(std::as_const(Function));
+                } catch (...) {
+                    Publish(Value, Position);
+                    std::invoke(Function);
+                    throw;
+                }
+            }
+            Publish(Value, Position);
+        }
+
+        void Flush() {
+            const std::size_t Target = Head.load(std::memory_order_acquire);
+
+            std::unique_lock Lock(Mutex);
+            ++Waiters;
+            WakeCondition.notify_one();
+            FlushCondition.wait(Lock, [this, Target]() { return Completed.load(std::memory_order_acquire) >= Target; });
+            --Waiters;
+        }
+
+        [[nodiscard]] std::size_t GetPending() const noexcept {
+            const std::size_t Enqueued = Head.load(std::memory_order_relaxed);
+            const std::size_t Done = Completed.load(std::memory_order_relaxed);
+            return Enqueued > Done ? Enqueued - Done : 0;
+        }
+
+    private:
+        bool IsReady() const noexcept {
+            const std::size_t Position = Completed.load(std::memory_order_relaxed);
+            return Cells[Position % Capacity].Sequence.load(std::memory_order_acquire) == Position + 1;
+        }
+
+        void Publish(Cell& Value, std::size_t Position) noexcept {
+            Value.Sequence.store(Position + 1, std::memory_order_release);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (bSleeping.load(std::memory_order_relaxed)) {
+                std::lock_guard Lock(Mutex);
+                WakeCondition.notify_one();
+            }
+        }
+
+        void Drain() noexcept {
+            std::size_t Position = Completed.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& Value = Cells[Position % Capacity];
+                if (Value.Sequence.load(std::memory_order_acquire) != Position + 1) {
+                    break;
+                }
+
+                if (Value.Function) {
+                    Value.Function();
+                    Value.Function.Reset();
+                }
+
+                Value.Sequence.store(Position + Capacity, std::memory_order_release);
+                Completed.store(++Position, std::memory_order_release);
+            }
+        }
+
+        void Run() noexcept {
+            std::unique_lock Lock(Mutex);
+            for (;;) {
+                Lock.unlock();
+                Drain();
+                Lock.lock();
+
+                if (Waiters != 0) {
+                    FlushCondition.notify_all();
+                }
+
+                bSleeping.store(true, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (!IsReady()) {
+                    if (bStop) {
+                        break;
+                    }
+                    WakeCondition.wait(Lock);
+                }
+                bSleeping.store(false, std::memory_order_relaxed);
+            }
+        }
+
+        std::unique_ptr<Cell[]> Cells;
+        alignas(CacheLine) std::atomic<std::size_t> Head = 0;
+        alignas(CacheLine) std::atomic<std::size_t> Completed = 0;
+        alignas(CacheLine) std::atomic<bool> bSleeping = false;
+        std::mutex Mutex;
+        std::condition_variable WakeCondition;
+        std::condition_variable FlushCondition;
+        std::size_t Waiters = 0;
+        bool bStop = false;
+        std::thread Worker;
+    };
+
+    using Reclaimer = BasicReclaimer<>;
+
+    // Holds a plain pointer to the reclaimer, which must outlive every resource released through this deleter.
+    template <typename D, typename TReclaimer = Reclaimer>
+    class DeferredDeleter {
+        static_assert(std::is_nothrow_copy_constructible_v<D>);
+
+    public:
+        template <typename D2, typename std::enable_if_t<std::is_constructible_v<D, D2>, int> = 0>
+        DeferredDeleter(D2&& Destruct, TReclaimer& Target) noexcept(std::is_nothrow_constructible_v<D, D2>) :
+            Destruct(std::forward<D2>(Destruct)),
+            Reclaimer(&Target) { }
+
+        template <typename T, typename std::enable_if_t<std::is_invocable_v<const D&, const details::RemoveCVRef<T>&>, int> = 0>
+        void operator()(T&& Resource) const noexcept {
+            static_assert(std::is_nothrow_copy_constructible_v<details::RemoveCVRef<T>>);
+
+            Reclaimer->Defer([Destruct = Destruct, Resource = std::as_const(Resource)]() noexcept {
+                (void) std::invoke(Destruct, Resource);
+            });
+        }
+
+        [[nodiscard]] const D& GetDeleter() const noexcept {
+            return Destruct;
+        }
+
+    private:
+        D Destruct;
+        TReclaimer* Reclaimer;
+    };
+
+    template <typename D2, typename TReclaimer>
+    DeferredDeleter(D2, TReclaimer&) -> DeferredDeleter<D2, TReclaimer>;
+}
\ No newline at end of file
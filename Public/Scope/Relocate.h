@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Details/Traits.h"
+
+namespace stdx {
+    template <typename T>
+    T* Relocate(T* First, T* Last, T* Destination) noexcept {
+        static_assert(IsTriviallyRelocatableV<T> || std::is_nothrow_move_constructible_v<T>);
+
+        if constexpr (IsTriviallyRelocatableV<T>) {
+            const std::size_t Count = std::size_t(Last - First);
+            if (Count != 0) {
+                std::memmove(static_cast<void*>(Destination), static_cast<const void*>(First), Count * sizeof(T));
+            }
+            return Destination + Count;
+        } else {
+            for (; First != Last; ++First, ++Destination) {
+                ::new (static_cast<void*>(Destination)) T(std::move(*First));
+                First->~T();
+            }
+            return Destination;
+        }
+    }
+
+    template <typename T>
+    void Relocate(T* Source, T* Destination) noexcept {
+        Relocate(Source, Source + 1, Destination);
+    }
+
+    template <typename T>
+    class RelocatingVector {
+        static_assert(IsTriviallyRelocatableV<T> || std::is_nothrow_move_constructible_v<T>);
+
+    public:
+        RelocatingVector() noexcept = default;
+
+        RelocatingVector(const RelocatingVector&) = delete;
+
+        RelocatingVector(RelocatingVector&& Other) noexcept :
+            Values(std::exchange(Other.Values, nullptr)),
+            Size(std::exchange(Other.Size, 0)),
+            Capacity(std::exchange(Other.Capacity, 0)) { }
+
+        ~RelocatingVector() {
+            Clear();
+            std::allocator<T>().deallocate(Values, Capacity);
+        }
+
+        RelocatingVector& operator=(const RelocatingVector&) = delete;
+
+        RelocatingVector& operator=(RelocatingVector&&) = delete;
+
+        template <typename... A>
+        T& EmplaceBack(A&&... Args) {
+            if (Size == Capacity) {
+                const std::size_t NewCapacity = Capacity ? 2 * Capacity : 4;
+                T* Grown = std::allocator<T>().allocate(NewCapacity);
+                try {
+                    ::new (static_cast<void*>(Grown + Size)) T(std::forward<A>(Args)...);
+                } catch (...) {
+                    std::allocator<T>().deallocate(Grown, NewCapacity);
+                    throw;
+                }
+                Adopt(Grown, NewCapacity);
+            } else {
+                ::new (static_cast<void*>(Values + Size)) T(std::forward<A>(Args)...);
+            }
+            return Values[Size++];
+        }
+
+        void PopBack() noexcept {
+            Values[--Size].~T();
+        }
+
+        void SwapErase(std::size_t Index) noexcept {
+            Values[Index].~T();
+            if (Index != --Size) {
+                Relocate(Values + Size, Values + Index);
+            }
+        }
+
+        void Reserve(std::size_t NewCapacity) {
+            if (NewCapacity > Capacity) {
+                Adopt(std::allocator<T>().allocate(NewCapacity), NewCapacity);
+            }
+        }
+
+        void Clear() noexcept {
+            while (Size) {
+                PopBack();
+            }
+        }
+
+        [[nodiscard]] T& operator[](std::size_t Index) noexcept {
+            return Values[Index];
+        }
+
+        [[nodiscard]] const T& operator[](std::size_t Index) const noexcept {
+            return Values[Index];
+        }
+
+        [[nodiscard]] std::size_t GetSize() const noexcept {
+            return Size;
+        }
+
+        [[nodiscard]] std::size_t GetCapacity() const noexcept {
+            return Capacity;
+        }
+
+        [[nodiscard]] bool IsEmpty() const noexcept {
+            return Size == 0;
+        }
+
+        [[nodiscard]] T* begin() noexcept {
+            return Values;
+        }
+
+        [[nodiscard]] T* end() noexcept {
+            return Values + Size;
+        }
+
+        [[nodiscard]] const T* begin() const noexcept {
+            return Values;
+        }
+
+        [[nodiscard]] const T* end() const noexcept {
+            return Values + Size;
+        }
+
+    private:
+        void Adopt(T* Grown, std::size_t NewCapacity) noexcept {
+            Relocate(Values, Values + Size, Grown);
+            std::allocator<T>().deallocate(Values, Capacity);
+            Values = Grown;
+            Capacity = NewCapacity;
+        }
+
+        T* Values = nullptr;
+        std::size_t Size = 0;
+        std::size_t Capacity = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "UniqueResource.h"
+
+namespace stdx {
+    struct PoolOptions {
+        std::size_t HighWatermark = 64;
+        std::size_t LowWatermark = 16;
+        std::size_t GlobalCapacity = std::numeric_limits<std::size_t>::max();
+    };
+
+    template <typename T>
+    class ResourcePool {
+        static_assert(!std::is_reference_v<T> && !std::is_array_v<T>);
+
+        struct alignas(alignof(T) > alignof(void*) ? alignof(T) : alignof(void*)) Node {
+            Node* Next;
+        };
+
+        struct Slot {
+            std::uint64_t Id = 0;
+            Node* Head = nullptr;
+            std::size_t Count = 0;
+        };
+
+        struct ThreadCache {
+            static constexpr std::size_t Size = 8;
+
+            ~ThreadCache() {
+                for (Slot& Value : Slots) {
+                    Destroy(std::exchange(Value.Head, nullptr));
+                }
+            }
+
+            Slot* Lookup(std::uint64_t Id) noexcept {
+                for (Slot& Value : Slots) {
+                    if (Value.Id == Id) {
+                        return &Value;
+                    }
+                }
+                return nullptr;
+            }
+
+            Slot& Find(std::uint64_t Id) noexcept {
+                Slot* Empty = nullptr;
+                for (Slot& Value : Slots) {
+                    if (Value.Id == Id) {
+                        return Value;
+                    }
+                    if (!Empty && Value.Id == 0) {
+                        Empty = &Value;
+                    }
+                }
+
+                Slot& Value = Empty ? *Empty : Slots[Id % Size];
+                Destroy(std::exchange(Value.Head, nullptr));
+                Value.Id = Id;
+                Value.Count = 0;
+                return Value;
+            }
+
+            Slot Slots[Size];
+        };
+
+    public:
+        struct Recycle {
+            void operator()(T* Value) const noexcept {
+                Pool->Put(Value);
+            }
+
+            ResourcePool* Pool;
+        };
+
+        using Handle = UniqueResource<T*, Recycle>;
+
+        template <typename F, typename std::enable_if_t<std::is_constructible_v<std::function<T()>, F>, int> = 0>
+        explicit ResourcePool(F&& Factory, const PoolOptions& Options = {}) :
+            Factory(std::forward<F>(Factory)),
+            Options(Options),
+            Id(NextId()) {
+            if (Options.LowWatermark > Options.HighWatermark) {
+                throw std::invalid_argument("ResourcePool: LowWatermark exceeds HighWatermark");
+            }
+        }
+
+        ResourcePool(const ResourcePool&) = delete;
+
+        ResourcePool(ResourcePool&&) = delete;
+
+        // Only the destroying thread's cache is drained: every other thread that used the pool must have exited first.
+        ~ResourcePool() {
+            if (Slot* Local = FindSlot()) {
+                Destroy(std::exchange(Local->Head, nullptr));
+                Local->Id = 0;
+                Local->Count = 0;
+            }
+            Destroy(Global.exchange(nullptr, std::memory_order_acquire));
+        }
+
+        ResourcePool& operator=(const ResourcePool&) = delete;
+
+        ResourcePool& operator=(ResourcePool&&) = delete;
+
+        [[nodiscard]] Handle Acquire() {
+            Slot& Local = GetSlot();
+            if (!Local.Head) {
+                Node* Chain = Global.exchange(nullptr, std::memory_order_acquire);
+                for (Node* Value = Chain; Value; Value = Value->Next) {
+                    ++Local.Count;
+                    GlobalCount.fetch_sub(1, std::memory_order_relaxed);
+                }
+                Local.Head = Chain;
+            }
+
+            if (Node* Value = Local.Head) {
+                Local.Head = Value->Next;
+                --Local.Count;
+                return Handle(GetValue(Value), Recycle{this});
+            }
+
+            return Handle(Create(), Recycle{this});
+        }
+
+        void Trim(std::size_t Keep = 0) noexcept {
+            if (Slot* Local = FindSlot()) {
+                while (Local->Count > Keep) {
+                    Node* Value = std::exchange(Local->Head, Local->Head->Next);
+                    Value->Next = nullptr;
+                    Destroy(Value);
+                    --Local->Count;
+                }
+            }
+
+            Node* Chain = Global.exchange(nullptr, std::memory_order_acquire);
+            for (Node* Value = Chain; Value; Value = Value->Next) {
+                GlobalCount.fetch_sub(1, std::memory_order_relaxed);
+            }
+            Destroy(Chain);
+        }
+
+        [[nodiscard]] std::size_t GetLocalSize() noexcept {
+            Slot* Local = FindSlot();
+            return Local ? Local->Count : 0;
+        }
+
+        [[nodiscard]] std::size_t GetGlobalSize() const noexcept {
+            return GlobalCount.load(std::memory_order_relaxed);
+        }
+
+    private:
+        static std::uint64_t NextId() noexcept {
+            static std::atomic<std::uint64_t> Counter = 0;
+            return Counter.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+        static ThreadCache& GetCache() noexcept {
+            thread_local ThreadCache Cache;
+            return Cache;
+        }
+
+        static T* GetValue(Node* Value) noexcept {
+            return std::launder(reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(Value) + sizeof(Node)));
+        }
+
+        static Node* GetNode(T* Value) noexcept {
+            return reinterpret_cast<Node*>(reinterpret_cast<unsigned char*>(Value) - sizeof(Node));
+        }
+
+        static void Destroy(Node* Value) noexcept {
+            while (Value) {
+                Node* Next = Value->Next;
+                GetValue(Value)->~T();
+                ::operator delete(Value, std::align_val_t(alignof(Node)));
+                Value = Next;
+            }
+        }
+
+        Slot& GetSlot() noexcept {
+            return GetCache().Find(Id);
+        }
+
+        Slot* FindSlot() noexcept {
+            return GetCache().Lookup(Id);
+        }
+
+        T* Create() {
+            void* Memory = ::operator new(sizeof(Node) + sizeof(T), std::align_val_t(alignof(Node)));
+            auto* Value = ::new (Memory) Node{nullptr};
+            try {
+                return ::new (static_cast<void*>(reinterpret_cast<unsigned char*>(Value) + sizeof(Node))) T(Factory());
+            } catch (...) {
+                ::operator delete(Memory, std::align_val_t(alignof(Node)));
+                throw;
+            }
+        }
+
+        void Put(T* Value) noexcept {
+            Slot& Local = GetSlot();
+
+            Node* Head = GetNode(Value);
+            Head->Next = std::exchange(Local.Head, Head);
+            if (++Local.Count <= Options.HighWatermark) {
+                return;
+            }
+
+            Node* First = Local.Head;
+            Node* Last = First;
+            std::size_t Count = 1;
+            while (Local.Count - Count > Options.LowWatermark) {
+                Last = Last->Next;
+                ++Count;
+            }
+            Local.Head = std::exchange(Last->Next, nullptr);
+            Local.Count -= Count;
+
+            if (GlobalCount.load(std::memory_order_relaxed) + Count > Options.GlobalCapacity) {
+                Destroy(First);
+                return;
+            }
+
+            GlobalCount.fetch_add(Count, std::memory_order_relaxed);
+            Last->Next = Global.load(std::memory_order_relaxed);
+            while (!Global.compare_exchange_weak(Last->Next, First, std::memory_order_release, std::memory_order_relaxed)) {
+            }
+        }
+
+        std::function<T()> Factory;
+        const PoolOptions Options;
+        const std::uint64_t Id;
+        std::atomic<Node*> Global = nullptr;
+        std::atomic<std::size_t> GlobalCount = 0;
+    };
+}
\ No newline at end of file
@@ -18,11 +18,21 @@ namespace stdx {
         explicit ScopeExit(U&& Function) noexcept(Constructible::NoExcept) try : Super(std::in_place, std::forward<F>(Function)) {
             static_assert(std::is_invocable_v<U&>);
         } catch (...) { std::invoke(Function); }
+
+        template <typename... A, typename std::enable_if_t<std::is_constructible_v<Super, std::in_place_t, A...>, int> = 0>
+        explicit ScopeExit(std::in_place_t, A&&... Args) noexcept(
+            std::is_nothrow_constructible_v<Super, std::in_place_t, A...>) :
+            Super(std::in_place, std::forward<A>(Args)...) {
+            static_assert(std::is_invocable_v<T&>);
+        }
     };
 
     template <typename T>
     ScopeExit(T)->ScopeExit<T>;
 
+    template <typename T>
+    struct IsTriviallyRelocatable<ScopeExit<T>> : IsTriviallyRelocatable<typename details::ScopeBox<T>::Type> { };
+
     template <typename T>
     class ScopeSuccess final : public details::ScopeGuard<details::SuccessPolicy<T>> {
         using Super = details::ScopeGuard<details::SuccessPolicy<T>>;
@@ -36,11 +46,21 @@ namespace stdx {
         explicit ScopeSuccess(U&& Function) noexcept(Constructible::NoExcept) : Super(std::in_place, std::forward<F>(Function)) {
             static_assert(std::is_invocable_v<U&>);
         }
+
+        template <typename... A, typename std::enable_if_t<std::is_constructible_v<Super, std::in_place_t, A...>, int> = 0>
+        explicit ScopeSuccess(std::in_place_t, A&&... Args) noexcept(
+            std::is_nothrow_constructible_v<Super, std::in_place_t, A...>) :
+            Super(std::in_place, std::forward<A>(Args)...) {
+            static_assert(std::is_invocable_v<T&>);
+        }
     };
 
     template <typename T>
     ScopeSuccess(T)->ScopeSuccess<T>;
 
+    template <typename T>
+    struct IsTriviallyRelocatable<ScopeSuccess<T>> : IsTriviallyRelocatable<typename details::ScopeBox<T>::Type> { };
+
     template <typename T>
     class ScopeFail final : public details::ScopeGuard<details::FailPolicy<T>> {
         using Super = details::ScopeGuard<details::FailPolicy<T>>;
@@ -54,8 +74,84 @@ namespace stdx {
         explicit ScopeFail(U&& Function) noexcept(Constructible::NoExcept) try : Super(std::in_place, std::forward<F>(Function)) {
             static_assert(std::is_invocable_v<U&>);
         } catch (...) { std::invoke(Function); }
+
+        template <typename... A, typename std::enable_if_t<std::is_constructible_v<Super, std::in_place_t, A...>, int> = 0>
+        explicit ScopeFail(std::in_place_t, A&&... Args) noexcept(
+            std::is_nothrow_constructible_v<Super, std::in_place_t, A...>) :
+            Super(std::in_place, std::forward<A>(Args)...) {
+            static_assert(std::is_invocable_v<T&>);
+        }
     };
 
     template <typename T>
     ScopeFail(T)->ScopeFail<T>;
+
+    template <typename T>
+    struct IsTriviallyRelocatable<ScopeFail<T>> : IsTriviallyRelocatable<typename details::ScopeBox<T>::Type> { };
+
+    template <typename T>
+    class ScopeCommit final : public details::ScopeGuard<details::CommitPolicy<T>> {
+        using Super = details::ScopeGuard<details::CommitPolicy<T>>;
+
+    public:
+        using Super::Commit;
+
+        template <
+            typename U,
+            typename Constructible = details::ScopeConstructible<Super, U>,
+            typename F = typename Constructible::Type,
+            typename std::enable_if_t<!std::is_same_v<details::RemoveCVRef<U>, ScopeCommit> && Constructible::Enable, int> = 0>
+        explicit ScopeCommit(U&& Function) noexcept(Constructible::NoExcept) : Super(std::in_place, std::forward<F>(Function)) {
+            static_assert(std::is_invocable_v<U&>);
+        }
+
+        template <typename... A, typename std::enable_if_t<std::is_constructible_v<Super, std::in_place_t, A...>, int> = 0>
+        explicit ScopeCommit(std::in_place_t, A&&... Args) noexcept(
+            std::is_nothrow_constructible_v<Super, std::in_place_t, A...>) :
+            Super(std::in_place, std::forward<A>(Args)...) {
+            static_assert(std::is_invocable_v<T&>);
+        }
+    };
+
+    template <typename T>
+    ScopeCommit(T)->ScopeCommit<T>;
+
+    template <typename T>
+    struct IsTriviallyRelocatable<ScopeCommit<T>> : IsTriviallyRelocatable<typename details::ScopeBox<T>::Type> { };
+
+    template <typename T>
+    class ScopeRollback final : public details::ScopeGuard<details::RollbackPolicy<T>> {
+        using Super = details::ScopeGuard<details::RollbackPolicy<T>>;
+
+    public:
+        using Super::Commit;
+
+        template <
+            typename U,
+            typename Constructible = details::ScopeConstructible<Super, U>,
+            typename F = typename Constructible::Type,
+            typename std::enable_if_t<!std::is_same_v<details::RemoveCVRef<U>, ScopeRollback> && Constructible::Enable, int> = 0>
+        explicit ScopeRollback(U&& Function) noexcept(Constructible::NoExcept) try : Super(std::in_place, std::forward<F>(Function)) {
+            static_assert(std::is_invocable_v<U&>);
+        } catch (...) { std::invoke(Function); }
+
+        template <typename... A, typename std::enable_if_t<std::is_constructible_v<Super, std::in_place_t, A...>, int> = 0>
+        explicit ScopeRollback(std::in_place_t, A&&... Args) noexcept(
+            std::is_nothrow_constructible_v<Super, std::in_place_t, A...>) :
+            Super(std::in_place, std::forward<A>(Args)...) {
+            static_assert(std::is_invocable_v<T&>);
+        }
+    };
+
+    template <typename T>
+    ScopeRollback(T)->ScopeRollback<T>;
+
+    template <typename T>
+    struct IsTriviallyRelocatable<ScopeRollback<T>> : IsTriviallyRelocatable<typename details::ScopeBox<T>::Type> { };
+
+    template <typename T, typename... A>
+    [[nodiscard]] ScopeExit<T> MakeScopeExit(A&&... Args) noexcept(
+        std::is_nothrow_constructible_v<ScopeExit<T>, std::in_place_t, A...>) {
+        return ScopeExit<T>(std::in_place, std::forward<A>(Args)...);
+    }
 }
\ No newline at end of file
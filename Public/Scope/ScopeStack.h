@@ -0,0 +1,179 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "Details/InlineFunction.h"
+#include "Details/Traits.h"
+
+namespace stdx {
+    template <std::size_t Size = 256>
+    class ScopeStack {
+        struct Entry {
+            const details::ErasedOperations* Operations;
+            Entry* Previous;
+        };
+
+        struct Chunk {
+            Chunk* Previous;
+            std::size_t Capacity;
+        };
+
+        static_assert(Size >= sizeof(Entry));
+
+    public:
+        ScopeStack() noexcept = default;
+
+        ScopeStack(const ScopeStack&) = delete;
+
+        ScopeStack(ScopeStack&& Other) {
+            Take(Other);
+        }
+
+        ~ScopeStack() {
+            Unwind(true);
+        }
+
+        ScopeStack& operator=(const ScopeStack&) = delete;
+
+        ScopeStack& operator=(ScopeStack&&) = delete;
+
+        template <typename U>
+        void Push(U&& Function) {
+            using F = std::decay_t<U>;
+
+            static_assert(std::is_invocable_v<F&>);
+            static_assert(std::is_nothrow_move_constructible_v<F>);
+            static_assert(alignof(F) <= alignof(std::max_align_t));
+
+            try {
+                Entry* Value = Reserve(details::ErasedOperationsOf<F>::Value);
+                if constexpr (std::is_nothrow_constructible_v<F, U>) {
+                    ::new (GetData(Value)) F(std::forward<U>(Function));
+                } else {
+                    ::new (GetData(Value)) F(std::as_const(Function));
+                }
+                Commit(Value);
+            } catch (...) {
+                std::invoke(Function);
+                throw;
+            }
+        }
+
+        [[nodiscard]] ScopeStack PopAll() {
+            ScopeStack Stack;
+            Stack.Take(*this);
+            return Stack;
+        }
+
+        void Release() noexcept {
+            Unwind(false);
+        }
+
+        [[nodiscard]] bool IsEmpty() const noexcept {
+            return Top == nullptr;
+        }
+
+    private:
+        static unsigned char* AlignUp(unsigned char* Pointer, std::size_t Alignment) noexcept {
+            const auto Address = reinterpret_cast<std::uintptr_t>(Pointer);
+            return Pointer + ((Alignment - Address % Alignment) % Alignment);
+        }
+
+        static void* GetData(Entry* Value) noexcept {
+            return AlignUp(reinterpret_cast<unsigned char*>(Value + 1), Value->Operations->Alignment);
+        }
+
+        static Entry* Reverse(Entry* Value) noexcept {
+            Entry* Reversed = nullptr;
+            while (Value) {
+                Entry* Previous = std::exchange(Value->Previous, Reversed);
+                Reversed = std::exchange(Value, Previous);
+            }
+            return Reversed;
+        }
+
+        Entry* Reserve(const details::ErasedOperations& Operations) {
+            auto Fit = [&Operations](unsigned char* Begin, unsigned char* End) -> Entry* {
+                unsigned char* Header = AlignUp(Begin, alignof(Entry));
+                unsigned char* Data = AlignUp(Header + sizeof(Entry), Operations.Alignment);
+                if (Header > End || std::size_t(End - Header) < std::size_t(Data - Header) + Operations.Size) {
+                    return nullptr;
+                }
+                return ::new (Header) Entry{&Operations, nullptr};
+            };
+
+            if (Entry* Value = Fit(Cursor, Limit)) {
+                return Value;
+            }
+
+            Grow(GetFootprint(Operations));
+            return Fit(Cursor, Limit);
+        }
+
+        static std::size_t GetFootprint(const details::ErasedOperations& Operations) noexcept {
+            return sizeof(Entry) + alignof(Entry) + Operations.Alignment + Operations.Size;
+        }
+
+        void Grow(std::size_t Required) {
+            const std::size_t Capacity = std::max({Size, Chunks ? 2 * Chunks->Capacity : Size, Required});
+
+            auto* Value = static_cast<Chunk*>(::operator new(sizeof(Chunk) + Capacity));
+            Value->Previous = Chunks;
+            Value->Capacity = Capacity;
+            Chunks = Value;
+
+            Cursor = reinterpret_cast<unsigned char*>(Value + 1);
+            Limit = Cursor + Capacity;
+        }
+
+        void Commit(Entry* Value) noexcept {
+            Cursor = static_cast<unsigned char*>(GetData(Value)) + Value->Operations->Size;
+            Value->Previous = std::exchange(Top, Value);
+        }
+
+        void Take(ScopeStack& Other) {
+            std::size_t Required = 0;
+            for (Entry* Value = Other.Top; Value; Value = Value->Previous) {
+                Required += GetFootprint(*Value->Operations);
+            }
+            if (Required > std::size_t(Limit - Cursor)) {
+                Grow(Required);
+            }
+
+            Entry* First = Reverse(std::exchange(Other.Top, nullptr));
+            for (Entry* Value = First; Value; Value = Value->Previous) {
+                Entry* Copy = Reserve(*Value->Operations);
+                Value->Operations->Move(GetData(Copy), GetData(Value));
+                Commit(Copy);
+            }
+            Other.Top = Reverse(First);
+            Other.Release();
+        }
+
+        void Unwind(bool bInvoke) noexcept {
+            while (Top) {
+                Entry* Value = std::exchange(Top, Top->Previous);
+                if (bInvoke) {
+                    Value->Operations->Invoke(GetData(Value));
+                }
+                Value->Operations->Destroy(GetData(Value));
+            }
+
+            while (Chunks) {
+                ::operator delete(std::exchange(Chunks, Chunks->Previous));
+            }
+
+            Cursor = Buffer;
+            Limit = Buffer + Size;
+        }
+
+        alignas(std::max_align_t) unsigned char Buffer[Size];
+        unsigned char* Cursor = Buffer;
+        unsigned char* Limit = Buffer + Size;
+        Entry* Top = nullptr;
+        Chunk* Chunks = nullptr;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+
+#include "Details/InlineFunction.h"
+#include "Details/Traits.h"
+
+namespace stdx {
+    template <std::size_t Capacity = 16, std::size_t Size = 2 * sizeof(void*)>
+    class ScopeTransaction {
+        using TAction = details::InlineFunction<Size>;
+
+    public:
+        ScopeTransaction() noexcept = default;
+
+        ScopeTransaction(const ScopeTransaction&) = delete;
+
+        ScopeTransaction(ScopeTransaction&&) = delete;
+
+        ~ScopeTransaction() {
+            if (std::uncaught_exceptions() > UnchaughtOnCreation) {
+                while (Count > 0) {
+                    std::invoke(Actions[--Count]);
+                }
+            }
+        }
+
+        ScopeTransaction& operator=(const ScopeTransaction&) = delete;
+
+        ScopeTransaction& operator=(ScopeTransaction&&) = delete;
+
+        template <typename U>
+        void Attach(U&& Function) {
+            using F = std::decay_t<U>;
+
+            static_assert(std::is_invocable_v<F&>);
+            static_assert(TAction::template Fits<F>, "Rollback action does not fit into the transaction slot");
+
+            try {
+                if (Count == Capacity) {
+                    throw std::length_error{"ScopeTransaction capacity exceeded"};
+                }
+                if constexpr (std::is_nothrow_constructible_v<F, U>) {
+                    Actions[Count].template Emplace<F>(std::forward<U>(Function));
+                } else {
+                    Actions[Count].template Emplace<F>(std::as_const(Function));
+                }
+                ++Count;
+            } catch (...) {
+                std::invoke(Function);
+                throw;
+            }
+        }
+
+        void Release() noexcept {
+            while (Count > 0) {
+                Actions[--Count].Reset();
+            }
+        }
+
+        [[nodiscard]] std::size_t GetSize() const noexcept {
+            return Count;
+        }
+
+    private:
+        TAction Actions[Capacity];
+        std::size_t Count = 0;
+        int UnchaughtOnCreation = std::uncaught_exceptions();
+    };
+}
\ No newline at end of file
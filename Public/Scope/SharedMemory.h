@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "UniqueHandle.h"
+#include "UniqueMapping.h"
+
+namespace stdx {
+    class SharedMemory {
+    public:
+        SharedMemory() noexcept = default;
+
+        [[nodiscard]] static SharedMemory Create(const char* Name, std::size_t Size) noexcept {
+            SharedMemory Result;
+            if (Size == 0) {
+                errno = EINVAL;
+                return Result;
+            }
+
+            UniqueFd Fd(::memfd_create(Name, MFD_CLOEXEC | MFD_ALLOW_SEALING));
+            if (!Fd.IsEngaged() || ::ftruncate(Fd.Get(), ::off_t(Size)) != 0 ||
+                ::fcntl(Fd.Get(), F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW) != 0) {
+                return Result;
+            }
+
+            Result.Region = details::Map(Size, PROT_READ | PROT_WRITE, MAP_SHARED, Fd.Get(), 0, {});
+            if (Result.Region.IsEngaged()) {
+                Result.Fd = std::move(Fd);
+            }
+            return Result;
+        }
+
+        [[nodiscard]] static SharedMemory Adopt(UniqueFd Fd, int Protection = PROT_READ) noexcept {
+            SharedMemory Result;
+            if (!Fd.IsEngaged()) {
+                errno = EBADF;
+                return Result;
+            }
+
+            const int Seals = ::fcntl(Fd.Get(), F_GET_SEALS);
+            if (Seals == -1) {
+                return Result;
+            }
+            if (!(Seals & F_SEAL_SHRINK)) {
+                errno = EPERM;
+                return Result;
+            }
+
+            struct ::stat Status;
+            if (::fstat(Fd.Get(), &Status) != 0) {
+                return Result;
+            }
+
+            Result.Region = details::Map(std::size_t(Status.st_size), Protection, MAP_SHARED, Fd.Get(), 0, {});
+            if (Result.Region.IsEngaged()) {
+                Result.Fd = std::move(Fd);
+            }
+            return Result;
+        }
+
+        bool Freeze() noexcept {
+            if (!IsEngaged()) {
+                errno = EBADF;
+                return false;
+            }
+
+            const std::size_t Size = Region.Get().Length;
+            Region.Reset();
+
+            const bool bSealed = ::fcntl(Fd.Get(), F_ADD_SEALS, F_SEAL_WRITE | F_SEAL_SEAL) == 0;
+            const int SealError = errno;
+
+            Region = details::Map(Size, PROT_READ, MAP_SHARED, Fd.Get(), 0, {});
+            if (!Region.IsEngaged()) {
+                Fd.Reset();
+                return false;
+            }
+
+            errno = bSealed ? errno : SealError;
+            return bSealed;
+        }
+
+        void Reset() noexcept {
+            Region.Reset();
+            Fd.Reset();
+        }
+
+        [[nodiscard]] bool IsEngaged() const noexcept {
+            return Region.IsEngaged();
+        }
+
+        [[nodiscard]] std::byte* Data() const noexcept {
+            return Region.Get().Data();
+        }
+
+        [[nodiscard]] std::size_t GetSize() const noexcept {
+            return IsEngaged() ? Region.Get().Length : 0;
+        }
+
+        [[nodiscard]] const UniqueFd& GetFd() const noexcept {
+            return Fd;
+        }
+
+        [[nodiscard]] const UniqueMapping& GetMapping() const noexcept {
+            return Region;
+        }
+
+    private:
+        UniqueFd Fd;
+        UniqueMapping Region;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+    #include <sched.h>
+#endif
+
+#include "Details/CompressedPair.h"
+#include "Details/ResourceBox.h"
+
+namespace stdx {
+    namespace details {
+        struct EmptyToken { };
+
+        inline std::size_t CurrentCore() noexcept {
+#if defined(__linux__)
+            const int Core = ::sched_getcpu();
+            if (Core >= 0) {
+                return std::size_t(Core);
+            }
+#endif
+            static std::atomic<std::size_t> Next = 0;
+            thread_local const std::size_t Index = Next.fetch_add(1, std::memory_order_relaxed);
+            return Index;
+        }
+
+        template <typename R, typename D, typename C>
+        struct SharedControlBlock {
+            using TResource = ResourceBox<R>;
+            using TDestruct = ResourceBox<D>;
+
+            template <typename R2, typename D2>
+            SharedControlBlock(R2&& Resource, D2&& Destruct) noexcept(
+                std::is_nothrow_constructible_v<TResource, std::in_place_t, R2> &&
+                std::is_nothrow_constructible_v<TDestruct, std::in_place_t, D2>) :
+                Data(
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::in_place, std::forward<R2>(Resource)),
+                    std::forward_as_tuple(std::in_place, std::forward<D2>(Destruct))) { }
+
+            C Counter;
+            CompressedPair<TResource, TDestruct> Data;
+        };
+    }
+
+    class AtomicRefCount {
+    public:
+        using Token = details::EmptyToken;
+
+        Token Acquire() noexcept {
+            Count.fetch_add(1, std::memory_order_relaxed);
+            return {};
+        }
+
+        bool Release(Token) noexcept {
+            return Count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        [[nodiscard]] std::size_t Get() const noexcept {
+            return Count.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<std::size_t> Count = 0;
+    };
+
+    class LocalRefCount {
+    public:
+        using Token = details::EmptyToken;
+
+        Token Acquire() noexcept {
+            ++Count;
+            return {};
+        }
+
+        bool Release(Token) noexcept {
+            return --Count == 0;
+        }
+
+        [[nodiscard]] std::size_t Get() const noexcept {
+            return Count;
+        }
+
+    private:
+        std::size_t Count = 0;
+    };
+
+    template <std::size_t Shards = 16>
+    class ShardedRefCount {
+        static_assert(Shards > 0);
+
+        struct alignas(64) Shard {
+            std::atomic<std::size_t> Count = 0;
+        };
+
+    public:
+        using Token = std::size_t;
+
+        Token Acquire() noexcept {
+            const Token Index = details::CurrentCore() % Shards;
+            if (Counts[Index].Count.fetch_add(1, std::memory_order_relaxed) == 0) {
+                Active.fetch_add(1, std::memory_order_relaxed);
+            }
+            return Index;
+        }
+
+        bool Release(Token Index) noexcept {
+            if (Counts[Index].Count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                return Active.fetch_sub(1, std::memory_order_acq_rel) == 1;
+            }
+            return false;
+        }
+
+        [[nodiscard]] std::size_t Get() const noexcept {
+            std::size_t Count = 0;
+            for (const Shard& Value : Counts) {
+                Count += Value.Count.load(std::memory_order_relaxed);
+            }
+            return Count;
+        }
+
+    private:
+        Shard Counts[Shards];
+        alignas(64) std::atomic<std::size_t> Active = 0;
+    };
+
+    template <typename R, typename D, typename C = AtomicRefCount>
+    class [[nodiscard]] SharedResource final {
+        using TBlock = details::SharedControlBlock<R, D, C>;
+        using TToken = typename C::Token;
+        using THandle = details::CompressedPair<TBlock*, TToken>;
+
+        using TResource = typename TBlock::TResource;
+        using TDestruct = typename TBlock::TDestruct;
+
+        static_assert(std::is_invocable_v<const typename TDestruct::Type&, decltype(std::declval<const TResource&>().Get())>);
+
+    public:
+        SharedResource() noexcept : Handle(std::piecewise_construct, std::forward_as_tuple(nullptr), std::tuple<>()) { }
+
+        template <
+            typename R2,
+            typename D2,
+            typename std::enable_if_t<
+                std::is_constructible_v<TResource, std::in_place_t, R2> && std::is_constructible_v<TDestruct, std::in_place_t, D2>,
+                int> = 0>
+        explicit SharedResource(R2&& Resource, D2&& Destruct) : SharedResource() {
+            try {
+                if constexpr (std::is_nothrow_constructible_v<TBlock, R2, D2>) {
+                    Handle.First() = new TBlock(std::forward<R2>(Resource), std::forward<D2>(Destruct));
+                } else {
+                    Handle.First() = new TBlock(std::as_const(Resource), std::as_const(Destruct));
+                }
+            } catch (...) {
+                std::invoke(Destruct, Resource);
+                throw;
+            }
+            Handle.Second() = Handle.First()->Counter.Acquire();
+        }
+
+        SharedResource(const SharedResource& Other) noexcept : SharedResource() {
+            if (Other.Handle.First()) {
+                Handle.Second() = Other.Handle.First()->Counter.Acquire();
+                Handle.First() = Other.Handle.First();
+            }
+        }
+
+        SharedResource(SharedResource&& Other) noexcept : Handle(Other.Handle) {
+            Other.Handle.First() = nullptr;
+        }
+
+        ~SharedResource() {
+            Reset();
+        }
+
+        SharedResource& operator=(const SharedResource& Other) noexcept {
+            if (this != &Other) {
+                *this = SharedResource(Other);
+            }
+            return *this;
+        }
+
+        SharedResource& operator=(SharedResource&& Other) noexcept {
+            if (this != &Other) {
+                Reset();
+                Handle = Other.Handle;
+                Other.Handle.First() = nullptr;
+            }
+            return *this;
+        }
+
+        void Reset() noexcept {
+            if (TBlock* Block = std::exchange(Handle.First(), nullptr)) {
+                if (Block->Counter.Release(Handle.Second())) {
+                    std::invoke(Block->Data.Second().Get(), Block->Data.First().Get());
+                    delete Block;
+                }
+            }
+        }
+
+        [[nodiscard]] decltype(auto) Get() const noexcept {
+            return std::as_const(Handle.First()->Data.First()).Get();
+        }
+
+        [[nodiscard]] decltype(auto) GetDeleter() const noexcept {
+            return std::as_const(Handle.First()->Data.Second()).Get();
+        }
+
+        [[nodiscard]] std::size_t GetCount() const noexcept {
+            return Handle.First() ? Handle.First()->Counter.Get() : 0;
+        }
+
+        explicit operator bool() const noexcept {
+            return Handle.First() != nullptr;
+        }
+
+        template <
+            typename T = typename TResource::Type,
+            typename std::enable_if_t<std::is_pointer_v<T> && !std::is_void_v<std::remove_pointer_t<T>>, int> = 0>
+        [[nodiscard]] auto operator->() const noexcept {
+            return Get();
+        }
+
+        template <
+            typename T = typename TResource::Type,
+            typename std::enable_if_t<std::is_pointer_v<T> && !std::is_void_v<std::remove_pointer_t<T>>, int> = 0>
+        [[nodiscard]] decltype(auto) operator*() const noexcept {
+            return *Get();
+        }
+
+    private:
+        THandle Handle;
+    };
+
+    template <typename R, typename D>
+    SharedResource(R, D) -> SharedResource<R, D>;
+
+    template <typename C = AtomicRefCount, typename R, typename D>
+    SharedResource<std::decay_t<R>, std::decay_t<D>, C> MakeSharedResource(R&& Resource, D&& Destruct) {
+        return SharedResource<std::decay_t<R>, std::decay_t<D>, C>(std::forward<R>(Resource), std::forward<D>(Destruct));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Details/ResourceBox.h"
+
+namespace stdx {
+    template <typename R, typename D, typename H = std::uint64_t, unsigned IndexBits = std::numeric_limits<H>::digits / 2>
+    class SlotMap {
+        using TDestruct = details::ResourceBox<D>;
+
+        static_assert(!std::is_reference_v<R>);
+        static_assert(std::is_nothrow_move_constructible_v<R> && std::is_nothrow_move_assignable_v<R>);
+        static_assert(std::is_invocable_v<const typename TDestruct::Type&, const R&>);
+        static_assert(std::is_unsigned_v<H> && IndexBits > 0 && IndexBits < unsigned(std::numeric_limits<H>::digits));
+
+        static constexpr bool HasRangeDestruct =
+            std::is_invocable_v<const typename TDestruct::Type&, const R*, const R*>;
+
+        static constexpr H IndexMask = (H(1) << IndexBits) - 1;
+        static constexpr H GenerationMask = H(~H(0)) >> IndexBits;
+        static constexpr H NoSlot = IndexMask;
+
+        struct Slot {
+            H Generation;
+            H Index;
+        };
+
+    public:
+        using Handle = H;
+
+        static constexpr Handle InvalidHandle = 0;
+
+        template <typename T = TDestruct, typename std::enable_if_t<std::is_default_constructible_v<T>, int> = 0>
+        SlotMap() noexcept(std::is_nothrow_default_constructible_v<T>) { }
+
+        template <typename D2, typename std::enable_if_t<std::is_constructible_v<TDestruct, std::in_place_t, D2>, int> = 0>
+        explicit SlotMap(D2&& Destruct) noexcept(std::is_nothrow_constructible_v<TDestruct, std::in_place_t, D2>) :
+            Destruct(std::in_place, std::forward<D2>(Destruct)) { }
+
+        SlotMap(const SlotMap&) = delete;
+
+        SlotMap(SlotMap&& Other) noexcept(std::is_nothrow_move_constructible_v<TDestruct>) :
+            Destruct(std::move(Other.Destruct)),
+            Values(std::move(Other.Values)),
+            Owners(std::move(Other.Owners)),
+            Slots(std::move(Other.Slots)),
+            FreeHead(std::exchange(Other.FreeHead, NoSlot)) {
+            Other.Values.clear();
+            Other.Owners.clear();
+            Other.Slots.clear();
+        }
+
+        ~SlotMap() {
+            Reset();
+        }
+
+        SlotMap& operator=(const SlotMap&) = delete;
+
+        SlotMap& operator=(SlotMap&&) = delete;
+
+        template <typename T, typename std::enable_if_t<std::is_constructible_v<R, T>, int> = 0>
+        Handle Insert(T&& Value) {
+            H Index = FreeHead;
+            try {
+                if (Index == NoSlot) {
+                    if (Slots.size() >= std::size_t(NoSlot)) {
+                        throw std::length_error("SlotMap: too many slots");
+                    }
+                    Grow(Slots);
+                }
+                Grow(Owners);
+                if constexpr (std::is_nothrow_constructible_v<R, T>) {
+                    Values.emplace_back(std::forward<T>(Value));
+                } else {
+                    Values.emplace_back(std::as_const(Value));
+                }
+            } catch (...) {
+                std::invoke(Destruct.Get(), std::as_const(Value));
+                throw;
+            }
+
+            if (Index == NoSlot) {
+                Index = H(Slots.size());
+                Slots.push_back(Slot{1, 0});
+            } else {
+                FreeHead = Slots[Index].Index;
+            }
+            Slots[Index].Index = H(Owners.size());
+            Owners.push_back(Index);
+
+            return MakeHandle(Slots[Index].Generation, Index);
+        }
+
+        [[nodiscard]] R* Find(Handle Key) noexcept {
+            const std::size_t Position = Locate(Key);
+            return Position == NotFound ? nullptr : Values.data() + Position;
+        }
+
+        [[nodiscard]] const R* Find(Handle Key) const noexcept {
+            const std::size_t Position = Locate(Key);
+            return Position == NotFound ? nullptr : Values.data() + Position;
+        }
+
+        [[nodiscard]] bool Contains(Handle Key) const noexcept {
+            return Locate(Key) != NotFound;
+        }
+
+        bool Erase(Handle Key) noexcept {
+            const std::size_t Position = Locate(Key);
+            if (Position == NotFound) {
+                return false;
+            }
+            std::invoke(Destruct.Get(), std::as_const(Values[Position]));
+            Remove(Position);
+            return true;
+        }
+
+        void Reserve(std::size_t Capacity) {
+            Values.reserve(Capacity);
+            Owners.reserve(Capacity);
+            Slots.reserve(Capacity);
+        }
+
+        void Reset() noexcept {
+            if constexpr (HasRangeDestruct) {
+                if (!Values.empty()) {
+                    std::invoke(Destruct.Get(), std::as_const(Values).data(), std::as_const(Values).data() + Values.size());
+                }
+            } else {
+                for (const R& Value : Values) {
+                    std::invoke(Destruct.Get(), Value);
+                }
+            }
+
+            for (H Owner : Owners) {
+                Retire(Owner);
+            }
+            Values.clear();
+            Owners.clear();
+        }
+
+        [[nodiscard]] Handle GetHandle(std::size_t Position) const noexcept {
+            const H Index = Owners[Position];
+            return MakeHandle(Slots[Index].Generation, Index);
+        }
+
+        [[nodiscard]] decltype(auto) GetDeleter() const noexcept {
+            return Destruct.Get();
+        }
+
+        [[nodiscard]] std::size_t GetSize() const noexcept {
+            return Values.size();
+        }
+
+        [[nodiscard]] bool IsEmpty() const noexcept {
+            return Values.empty();
+        }
+
+        [[nodiscard]] R* Data() noexcept {
+            return Values.data();
+        }
+
+        [[nodiscard]] const R* Data() const noexcept {
+            return Values.data();
+        }
+
+        [[nodiscard]] R* begin() noexcept {
+            return Values.data();
+        }
+
+        [[nodiscard]] R* end() noexcept {
+            return Values.data() + Values.size();
+        }
+
+        [[nodiscard]] const R* begin() const noexcept {
+            return Values.data();
+        }
+
+        [[nodiscard]] const R* end() const noexcept {
+            return Values.data() + Values.size();
+        }
+
+    private:
+        template <typename T>
+        static void Grow(std::vector<T>& Vector) {
+            if (Vector.size() == Vector.capacity()) {
+                Vector.reserve(std::max<std::size_t>(4, 2 * Vector.capacity()));
+            }
+        }
+
+        static constexpr std::size_t NotFound = std::size_t(-1);
+
+        static Handle MakeHandle(H Generation, H Index) noexcept {
+            return H(Generation << IndexBits) | Index;
+        }
+
+        std::size_t Locate(Handle Key) const noexcept {
+            const H Index = Key & IndexMask;
+            if (Index >= Slots.size()) {
+                return NotFound;
+            }
+            const Slot& Value = Slots[Index];
+            if (Value.Generation != (Key >> IndexBits) || Value.Index >= Owners.size() || Owners[Value.Index] != Index) {
+                return NotFound;
+            }
+            return std::size_t(Value.Index);
+        }
+
+        void Retire(H Index) noexcept {
+            Slot& Value = Slots[Index];
+            Value.Generation = (Value.Generation + 1) & GenerationMask;
+            if (Value.Generation == 0) {
+                Value.Generation = 1;
+            }
+            Value.Index = std::exchange(FreeHead, Index);
+        }
+
+        void Remove(std::size_t Position) noexcept {
+            Retire(Owners[Position]);
+
+            const std::size_t Last = Values.size() - 1;
+            if (Position != Last) {
+                Values[Position] = std::move(Values[Last]);
+                Owners[Position] = Owners[Last];
+                Slots[Owners[Position]].Index = H(Position);
+            }
+            Values.pop_back();
+            Owners.pop_back();
+        }
+
+        TDestruct Destruct;
+        std::vector<R> Values;
+        std::vector<H> Owners;
+        std::vector<Slot> Slots;
+        H FreeHead = NoSlot;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cerrno>
+#include <cstdio>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+    #include <sys/syscall.h>
+#endif
+
+#include "UniqueResource.h"
+
+namespace stdx {
+    namespace details {
+        class ErrnoGuard {
+        public:
+            ErrnoGuard() noexcept : Value(errno) { }
+
+            ErrnoGuard(const ErrnoGuard&) = delete;
+
+            ~ErrnoGuard() {
+                errno = Value;
+            }
+
+            ErrnoGuard& operator=(const ErrnoGuard&) = delete;
+
+        private:
+            int Value;
+        };
+    }
+
+    struct FdDeleter {
+        void operator()(int Fd) const noexcept {
+            details::ErrnoGuard Guard;
+            ::close(Fd);
+        }
+
+        void operator()(const int* First, const int* Last) const noexcept {
+            details::ErrnoGuard Guard;
+            while (First != Last) {
+                const int* End = First + 1;
+                while (End != Last && *End == *(End - 1) + 1) {
+                    ++End;
+                }
+#if defined(__linux__) && defined(SYS_close_range)
+                if (End - First > 1 && ::syscall(SYS_close_range, unsigned(*First), unsigned(*(End - 1)), 0u) == 0) {
+                    First = End;
+                    continue;
+                }
+#endif
+                for (; First != End; ++First) {
+                    ::close(*First);
+                }
+            }
+        }
+    };
+
+    struct FileDeleter {
+        void operator()(std::FILE* File) const noexcept {
+            details::ErrnoGuard Guard;
+            std::fclose(File);
+        }
+    };
+
+    struct DirDeleter {
+        void operator()(DIR* Dir) const noexcept {
+            details::ErrnoGuard Guard;
+            ::closedir(Dir);
+        }
+    };
+
+    using UniqueFd = UniqueResource<int, FdDeleter, Sentinel<-1>>;
+    using UniqueFile = UniqueResource<std::FILE*, FileDeleter, Sentinel<nullptr>>;
+    using UniqueDir = UniqueResource<DIR*, DirDeleter, Sentinel<nullptr>>;
+
+    [[nodiscard]] inline UniqueFd OpenFd(const char* Path, int Flags, ::mode_t Mode = 0) noexcept {
+        int Fd;
+        do {
+            Fd = ::open(Path, Flags, Mode);
+        } while (Fd == -1 && errno == EINTR);
+        return UniqueFd(Fd);
+    }
+
+    [[nodiscard]] inline UniqueFile OpenFile(const char* Path, const char* Mode) noexcept {
+        return UniqueFile(std::fopen(Path, Mode));
+    }
+
+    [[nodiscard]] inline UniqueDir OpenDir(const char* Path) noexcept {
+        return UniqueDir(::opendir(Path));
+    }
+}
\ No newline at end of file
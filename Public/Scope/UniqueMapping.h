@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "UniqueHandle.h"
+#include "UniqueResource.h"
+
+namespace stdx {
+    struct Mapping {
+        [[nodiscard]] std::byte* Data() const noexcept {
+            return static_cast<std::byte*>(Address);
+        }
+
+        friend bool operator==(const Mapping& Left, const Mapping& Right) noexcept {
+            return Left.Address == Right.Address && Left.Length == Right.Length;
+        }
+
+        void* Address;
+        std::size_t Length;
+    };
+
+    struct MappingSentinel {
+        static Mapping Invalid() noexcept {
+            return {MAP_FAILED, 0};
+        }
+    };
+
+    struct MappingDeleter {
+        void operator()(const Mapping& Value) const noexcept {
+            details::ErrnoGuard Guard;
+            ::munmap(Value.Address, Value.Length);
+        }
+    };
+
+    struct MappingUnlockDeleter {
+        void operator()(const Mapping& Value) const noexcept {
+            details::ErrnoGuard Guard;
+            ::munlock(Value.Address, Value.Length);
+        }
+    };
+
+    struct MappingOptions {
+        bool bPopulate = false;
+        bool bTransparentHugePages = false;
+        bool bHugeTlb = false;
+        bool bLock = false;
+    };
+
+    using UniqueMapping = UniqueResource<Mapping, MappingDeleter, MappingSentinel>;
+    using UniqueMappingLock = UniqueResource<Mapping, MappingUnlockDeleter, MappingSentinel>;
+
+    namespace details {
+        constexpr std::size_t HugePageSize = std::size_t(2) << 20;
+
+        inline std::size_t AlignUp(std::size_t Value, std::size_t Alignment) noexcept {
+            return (Value + Alignment - 1) / Alignment * Alignment;
+        }
+
+        inline void Prefault(const Mapping& Value, int Protection) noexcept {
+#if defined(MADV_POPULATE_READ) && defined(MADV_POPULATE_WRITE)
+            const int Advice = (Protection & PROT_WRITE) ? MADV_POPULATE_WRITE : MADV_POPULATE_READ;
+            if (::madvise(Value.Address, Value.Length, Advice) == 0) {
+                return;
+            }
+#endif
+            const auto PageSize = std::size_t(::sysconf(_SC_PAGESIZE));
+            for (std::size_t Offset = 0; Offset < Value.Length; Offset += PageSize) {
+                auto* Page = static_cast<volatile unsigned char*>(Value.Address) + Offset;
+                if (Protection & PROT_WRITE) {
+                    *Page = *Page;
+                } else {
+                    (void) *Page;
+                }
+            }
+        }
+
+        inline Mapping MapAligned(std::size_t Length, int Protection, int Flags, int Fd, ::off_t Offset) noexcept {
+            void* Address = ::mmap(nullptr, Length + HugePageSize, Protection, Flags, Fd, Offset);
+            if (Address == MAP_FAILED) {
+                return MappingSentinel::Invalid();
+            }
+
+            const auto Begin = reinterpret_cast<std::uintptr_t>(Address);
+            const auto Aligned = AlignUp(Begin, HugePageSize);
+            if (Aligned != Begin) {
+                ::munmap(Address, Aligned - Begin);
+            }
+            if (const std::size_t Tail = HugePageSize - (Aligned - Begin)) {
+                ::munmap(reinterpret_cast<void*>(Aligned + Length), Tail);
+            }
+            return {reinterpret_cast<void*>(Aligned), Length};
+        }
+
+        inline UniqueMapping
+            Map(std::size_t Length, int Protection, int Flags, int Fd, ::off_t Offset, const MappingOptions& Options) noexcept {
+            if (Length == 0) {
+                errno = EINVAL;
+                return UniqueMapping();
+            }
+
+            const bool bDeferPopulate = Options.bPopulate && Options.bTransparentHugePages;
+#if defined(MAP_POPULATE)
+            if (Options.bPopulate && !bDeferPopulate) {
+                Flags |= MAP_POPULATE;
+            }
+#endif
+
+            UniqueMapping Result;
+#if defined(MAP_HUGETLB)
+            if (Options.bHugeTlb && Fd == -1) {
+                const std::size_t HugeLength = AlignUp(Length, HugePageSize);
+                ErrnoGuard Guard;
+                void* Address = ::mmap(nullptr, HugeLength, Protection, Flags | MAP_HUGETLB, Fd, Offset);
+                if (Address != MAP_FAILED) {
+                    Result.Reset(Mapping{Address, HugeLength});
+                }
+            }
+#endif
+
+            if (!Result.IsEngaged()) {
+                const Mapping Value = Options.bTransparentHugePages && Fd == -1 ?
+                    MapAligned(AlignUp(Length, HugePageSize), Protection, Flags, Fd, Offset) :
+                    Mapping{::mmap(nullptr, Length, Protection, Flags, Fd, Offset), Length};
+                if (Value.Address == MAP_FAILED) {
+                    return UniqueMapping();
+                }
+                Result.Reset(Value);
+
+#if defined(MADV_HUGEPAGE)
+                if (Options.bTransparentHugePages) {
+                    ErrnoGuard Guard;
+                    ::madvise(Result.Get().Address, Result.Get().Length, MADV_HUGEPAGE);
+                }
+#endif
+            }
+
+            if (bDeferPopulate) {
+                ErrnoGuard Guard;
+                Prefault(Result.Get(), Protection);
+            }
+
+            if (Options.bLock && ::mlock(Result.Get().Address, Result.Get().Length) != 0) {
+                Result.Reset();
+            }
+
+            return Result;
+        }
+    }
+
+    [[nodiscard]] inline UniqueMapping
+        MapAnonymous(std::size_t Length, const MappingOptions& Options = {}, int Protection = PROT_READ | PROT_WRITE) noexcept {
+        return details::Map(Length, Protection, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0, Options);
+    }
+
+    [[nodiscard]] inline UniqueMapping
+        MapFile(int Fd, std::size_t Length, ::off_t Offset = 0, const MappingOptions& Options = {}) noexcept {
+        return details::Map(Length, PROT_READ, MAP_SHARED, Fd, Offset, Options);
+    }
+
+    [[nodiscard]] inline UniqueMapping MapFile(const char* Path, const MappingOptions& Options = {}) noexcept {
+        UniqueFd Fd = OpenFd(Path, O_RDONLY | O_CLOEXEC);
+        if (!Fd.IsEngaged()) {
+            return UniqueMapping();
+        }
+
+        struct ::stat Status;
+        if (::fstat(Fd.Get(), &Status) != 0) {
+            return UniqueMapping();
+        }
+
+        return MapFile(Fd.Get(), std::size_t(Status.st_size), 0, Options);
+    }
+
+    [[nodiscard]] inline UniqueMappingLock LockMapping(const Mapping& Value) noexcept {
+        if (::mlock(Value.Address, Value.Length) != 0) {
+            return UniqueMappingLock();
+        }
+        return UniqueMappingLock(Value);
+    }
+}
\ No newline at end of file
@@ -11,52 +11,97 @@
 #endif
 
 namespace stdx {
-    template <typename R, typename D>
-    class [[nodiscard]] UniqueResource final : private details::UniqueResourceMoveAssign<R, D> {
-        using Super = details::UniqueResourceMoveAssign<R, D>;
+    template <auto Function>
+    struct FunctionDeleter {
+        template <typename T, typename std::enable_if_t<std::is_invocable_v<decltype(Function), T>, int> = 0>
+        void operator()(T&& Resource) const noexcept(std::is_nothrow_invocable_v<decltype(Function), T>) {
+            (void) std::invoke(Function, std::forward<T>(Resource));
+        }
+    };
+
+    struct NoopDeleter {
+        template <typename T>
+        void operator()(T&&) const noexcept { }
+    };
+
+    template <auto Value>
+    struct Sentinel {
+        static constexpr auto Invalid() noexcept {
+            return Value;
+        }
+    };
+
+    template <typename R, typename D, typename S = void>
+    class [[nodiscard]] UniqueResource final : private details::SelectUniqueResourceBase<R, D, S> {
+        using Super = details::SelectUniqueResourceBase<R, D, S>;
         using typename Super::D1;
         using typename Super::R1;
         using typename Super::TDestruct;
         using typename Super::TResource;
 
     public:
+        using Super::IsEngaged;
         using Super::Release;
         using Super::Reset;
 
         UniqueResource() = default;
 
+        template <
+            typename R2,
+            typename D2 = D1,
+            typename std::enable_if_t<
+                !std::is_same_v<details::RemoveCVRef<R2>, UniqueResource> && std::is_empty_v<D2> &&
+                    std::is_default_constructible_v<D2>,
+                int> = 0>
+        explicit UniqueResource(R2 && Resource) noexcept(noexcept(UniqueResource(std::declval<R2>(), std::declval<D2>()))) :
+            UniqueResource(std::forward<R2>(Resource), D2()) { }
+
         template <
             typename R2,
             typename D2,
             bool NoExcept = noexcept(UniqueResource(std::declval<R2>(), std::declval<D2>(), true))>
         explicit UniqueResource(R2 && Resource, D2 && Destruct) noexcept(NoExcept) :
-            UniqueResource(std::forward<R2>(Resource), std::forward<D2>(Destruct), true) { }
+            UniqueResource(std::forward<R2>(Resource), std::forward<D2>(Destruct), Super::IsValid(Resource)) { }
 
-        [[nodiscard]] decltype(auto) Get() const noexcept {
+        template <
+            typename... RArgs,
+            typename... DArgs,
+            typename std::enable_if_t<
+                std::is_constructible_v<TResource, std::in_place_t, RArgs...> &&
+                    std::is_nothrow_constructible_v<TDestruct, std::in_place_t, DArgs...>,
+                int> = 0>
+        UniqueResource(std::piecewise_construct_t, std::tuple<RArgs...> Resource, std::tuple<DArgs...> Destruct) noexcept(
+            std::is_nothrow_constructible_v<TResource, std::in_place_t, RArgs...>) :
+            Super(
+                std::tuple_cat(std::tuple<std::in_place_t>(std::in_place), std::move(Resource)),
+                std::tuple_cat(std::tuple<std::in_place_t>(std::in_place), std::move(Destruct)),
+                true) { }
+
+        [[nodiscard]] SCOPE_FORCE_INLINE decltype(auto) Get() const noexcept {
             return Super::Resource().Get();
         }
 
-        [[nodiscard]] decltype(auto) GetDeleter() const noexcept {
+        [[nodiscard]] SCOPE_FORCE_INLINE decltype(auto) GetDeleter() const noexcept {
             return Super::Destruct().Get();
         }
 
         template <
             typename T = R1,
             typename std::enable_if_t<std::is_pointer_v<T> && !std::is_void_v<std::remove_pointer_t<T>>, int> = 0>
-        [[nodiscard]] auto operator->() const noexcept {
+        [[nodiscard]] SCOPE_FORCE_INLINE auto operator->() const noexcept {
             return Get();
         }
 
         template <
             typename T = R1,
             typename std::enable_if_t<std::is_pointer_v<T> && !std::is_void_v<std::remove_pointer_t<T>>, int> = 0>
-        [[nodiscard]] decltype(auto) operator*() const noexcept {
+        [[nodiscard]] SCOPE_FORCE_INLINE decltype(auto) operator*() const noexcept {
             return *Get();
         }
 
     private:
-        template <typename R2, typename D2, typename S>
-        friend auto MakeUniqueResourceChecked(R2 && Resource, const S& Sentinel, D2&& Destruct)
+        template <typename R2, typename D2, typename S2>
+        friend auto MakeUniqueResourceChecked(R2 && Resource, const S2& Sentinel, D2&& Destruct)
             MAKE_UNIQUE_RESOURCE_CHECKED_NOEXCEPT(R2, D2);
 
         template <
@@ -99,6 +144,12 @@ namespace stdx {
                 bExecuteOnReset) { }
     };
 
+    template <typename R, typename D, typename S>
+    struct IsTriviallyRelocatable<UniqueResource<R, D, S>>
+        : std::bool_constant<
+              IsTriviallyRelocatableV<typename details::ResourceBox<R>::Type> &&
+              IsTriviallyRelocatableV<typename details::ResourceBox<D>::Type>> { };
+
     template <typename R, typename D>
     UniqueResource(R, D)->UniqueResource<R, D>;
 
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Details/Bits.h"
+#include "Details/ResourceBox.h"
+
+namespace stdx {
+    template <typename R, typename D>
+    class UniqueResourceSet {
+        using TDestruct = details::ResourceBox<D>;
+
+        static_assert(!std::is_reference_v<R>);
+        static_assert(std::is_nothrow_move_constructible_v<R> || std::is_copy_constructible_v<R>);
+        static_assert(std::is_invocable_v<const typename TDestruct::Type&, const R&>);
+
+        static constexpr bool HasRangeDestruct =
+            std::is_invocable_v<const typename TDestruct::Type&, const R*, const R*>;
+
+    public:
+        template <typename T = TDestruct, typename std::enable_if_t<std::is_default_constructible_v<T>, int> = 0>
+        UniqueResourceSet() noexcept(std::is_nothrow_default_constructible_v<T>) { }
+
+        template <typename D2, typename std::enable_if_t<std::is_constructible_v<TDestruct, std::in_place_t, D2>, int> = 0>
+        explicit UniqueResourceSet(D2&& Destruct) noexcept(std::is_nothrow_constructible_v<TDestruct, std::in_place_t, D2>) :
+            Destruct(std::in_place, std::forward<D2>(Destruct)) { }
+
+        UniqueResourceSet(const UniqueResourceSet&) = delete;
+
+        UniqueResourceSet(UniqueResourceSet&& Other) noexcept(std::is_nothrow_move_constructible_v<TDestruct>) :
+            Destruct(std::move(Other.Destruct)),
+            Values(std::move(Other.Values)),
+            Bitmap(std::move(Other.Bitmap)) {
+            Other.Values.clear();
+            Other.Bitmap.clear();
+        }
+
+        ~UniqueResourceSet() {
+            Reset();
+        }
+
+        UniqueResourceSet& operator=(const UniqueResourceSet&) = delete;
+
+        UniqueResourceSet& operator=(UniqueResourceSet&&) = delete;
+
+        template <typename T, typename std::enable_if_t<std::is_constructible_v<R, T>, int> = 0>
+        std::size_t Insert(T&& Value) {
+            const std::size_t Index = Values.size();
+            try {
+                Bitmap.resize(Index / details::BitsPerWord + 1);
+                if constexpr (std::is_nothrow_constructible_v<R, T>) {
+                    Values.emplace_back(std::forward<T>(Value));
+                } else {
+                    Values.emplace_back(std::as_const(Value));
+                }
+            } catch (...) {
+                std::invoke(Destruct.Get(), std::as_const(Value));
+                throw;
+            }
+            Bitmap[Index / details::BitsPerWord] |= Mask(Index);
+            return Index;
+        }
+
+        void Reserve(std::size_t Capacity) {
+            Values.reserve(Capacity);
+            Bitmap.reserve((Capacity + details::BitsPerWord - 1) / details::BitsPerWord);
+        }
+
+        [[nodiscard]] const R& Get(std::size_t Index) const noexcept {
+            return Values[Index];
+        }
+
+        [[nodiscard]] decltype(auto) GetDeleter() const noexcept {
+            return Destruct.Get();
+        }
+
+        [[nodiscard]] std::size_t GetSize() const noexcept {
+            return Values.size();
+        }
+
+        [[nodiscard]] bool IsEngaged(std::size_t Index) const noexcept {
+            return (Bitmap[Index / details::BitsPerWord] & Mask(Index)) != 0;
+        }
+
+        void Release(std::size_t Index) noexcept {
+            Bitmap[Index / details::BitsPerWord] &= ~Mask(Index);
+        }
+
+        void Reset(std::size_t Index) noexcept {
+            if (IsEngaged(Index)) {
+                Release(Index);
+                std::invoke(Destruct.Get(), Values[Index]);
+            }
+        }
+
+        void Reset() noexcept {
+            details::ForEachRun(Bitmap.data(), Bitmap.size(), Values.size(), [this](std::size_t First, std::size_t Last) {
+                if constexpr (HasRangeDestruct) {
+                    std::invoke(Destruct.Get(), Values.data() + First, Values.data() + Last);
+                } else {
+                    for (std::size_t Index = First; Index < Last; ++Index) {
+                        std::invoke(Destruct.Get(), std::as_const(Values[Index]));
+                    }
+                }
+            });
+
+            Values.clear();
+            Bitmap.clear();
+        }
+
+    private:
+        static std::uint64_t Mask(std::size_t Index) noexcept {
+            return std::uint64_t(1) << (Index % details::BitsPerWord);
+        }
+
+        TDestruct Destruct;
+        std::vector<R> Values;
+        std::vector<std::uint64_t> Bitmap;
+    };
+}
\ No newline at end of file
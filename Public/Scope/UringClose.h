@@ -0,0 +1,275 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace stdx {
+    namespace details {
+        class UringRing {
+            static constexpr unsigned Entries = 64;
+
+        public:
+            static UringRing& Local() noexcept {
+                thread_local UringRing Ring;
+                return Ring;
+            }
+
+            UringRing(const UringRing&) = delete;
+
+            UringRing(UringRing&&) = delete;
+
+            ~UringRing() {
+                Submit();
+                if (SqRing != MAP_FAILED) {
+                    ::munmap(SqRing, SqSize);
+                }
+                if (CqRing != MAP_FAILED && CqRing != SqRing) {
+                    ::munmap(CqRing, CqSize);
+                }
+                if (Sqes != MAP_FAILED) {
+                    ::munmap(Sqes, Entries * sizeof(io_uring_sqe));
+                }
+                if (RingFd >= 0) {
+                    ::close(RingFd);
+                }
+            }
+
+            UringRing& operator=(const UringRing&) = delete;
+
+            UringRing& operator=(UringRing&&) = delete;
+
+            [[nodiscard]] bool IsAvailable() const noexcept {
+                return bAvailable;
+            }
+
+            [[nodiscard]] static bool IsBatching() noexcept {
+                return Depth() != 0;
+            }
+
+            void Enter() noexcept {
+                ++Depth();
+            }
+
+            void Leave() noexcept {
+                if (--Depth() == 0) {
+                    Submit();
+                }
+            }
+
+            void Close(int Fd) noexcept {
+                if (!bAvailable || !IsBatching()) {
+                    ::close(Fd);
+                    return;
+                }
+
+                if (Pending == Entries) {
+                    Submit();
+                    if (!bAvailable) {
+                        ::close(Fd);
+                        return;
+                    }
+                }
+
+                const unsigned Tail = *SqTail;
+                const unsigned Index = Tail & *SqMask;
+
+                io_uring_sqe& Entry = Sqes[Index];
+                std::memset(&Entry, 0, sizeof(Entry));
+                Entry.opcode = IORING_OP_CLOSE;
+                Entry.fd = Fd;
+                Entry.user_data = static_cast<unsigned>(Fd);
+
+                SqArray[Index] = Index;
+                __atomic_store_n(SqTail, Tail + 1, __ATOMIC_RELEASE);
+                ++Pending;
+            }
+
+            void Submit() noexcept {
+                if (Pending == 0) {
+                    return;
+                }
+
+                const int SavedErrno = errno;
+
+                unsigned Submitted = 0;
+                while (Submitted < Pending) {
+                    const long Result = ::syscall(
+                        __NR_io_uring_enter, RingFd, Pending - Submitted, Pending - Submitted, IORING_ENTER_GETEVENTS, nullptr, 0);
+                    if (Result < 0) {
+                        if (errno == EINTR) {
+                            continue;
+                        }
+                        break;
+                    }
+                    Submitted += static_cast<unsigned>(Result);
+                }
+
+                if (Submitted < Pending) {
+                    const unsigned Head = __atomic_load_n(SqHead, __ATOMIC_ACQUIRE);
+                    for (unsigned Position = Head; Position != *SqTail; ++Position) {
+                        ::close(Sqes[SqArray[Position & *SqMask]].fd);
+                    }
+                    __atomic_store_n(SqTail, Head, __ATOMIC_RELEASE);
+                    bAvailable = false;
+                }
+
+                Reap(Submitted);
+                Pending = 0;
+
+                errno = SavedErrno;
+            }
+
+        private:
+            static unsigned& Depth() noexcept {
+                thread_local unsigned Value = 0;
+                return Value;
+            }
+
+            UringRing() noexcept {
+                io_uring_params Params;
+                std::memset(&Params, 0, sizeof(Params));
+
+                RingFd = static_cast<int>(::syscall(__NR_io_uring_setup, Entries, &Params));
+                if (RingFd < 0) {
+                    return;
+                }
+
+                SqSize = Params.sq_off.array + Params.sq_entries * sizeof(unsigned);
+                CqSize = Params.cq_off.cqes + Params.cq_entries * sizeof(io_uring_cqe);
+                if (Params.features & IORING_FEAT_SINGLE_MMAP) {
+                    SqSize = CqSize = std::max(SqSize, CqSize);
+                }
+
+                SqRing = ::mmap(nullptr, SqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_SQ_RING);
+                if (SqRing == MAP_FAILED) {
+                    return;
+                }
+
+                if (Params.features & IORING_FEAT_SINGLE_MMAP) {
+                    CqRing = SqRing;
+                } else {
+                    CqRing =
+                        ::mmap(nullptr, CqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_CQ_RING);
+                    if (CqRing == MAP_FAILED) {
+                        return;
+                    }
+                }
+
+                void* Entry = ::mmap(
+                    nullptr, Entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd,
+                    IORING_OFF_SQES);
+                if (Entry == MAP_FAILED) {
+                    return;
+                }
+                Sqes = static_cast<io_uring_sqe*>(Entry);
+
+                auto* Sq = static_cast<unsigned char*>(SqRing);
+                SqHead = reinterpret_cast<unsigned*>(Sq + Params.sq_off.head);
+                SqTail = reinterpret_cast<unsigned*>(Sq + Params.sq_off.tail);
+                SqMask = reinterpret_cast<unsigned*>(Sq + Params.sq_off.ring_mask);
+                SqArray = reinterpret_cast<unsigned*>(Sq + Params.sq_off.array);
+
+                auto* Cq = static_cast<unsigned char*>(CqRing);
+                CqHead = reinterpret_cast<unsigned*>(Cq + Params.cq_off.head);
+                CqTail = reinterpret_cast<unsigned*>(Cq + Params.cq_off.tail);
+                CqMask = reinterpret_cast<unsigned*>(Cq + Params.cq_off.ring_mask);
+                Cqes = reinterpret_cast<io_uring_cqe*>(Cq + Params.cq_off.cqes);
+
+                bAvailable = true;
+            }
+
+            void Reap(unsigned Count) noexcept {
+                unsigned Head = *CqHead;
+                while (Count != 0) {
+                    const unsigned Tail = __atomic_load_n(CqTail, __ATOMIC_ACQUIRE);
+                    if (Head == Tail) {
+                        if (::syscall(__NR_io_uring_enter, RingFd, 0, Count, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 &&
+                            errno != EINTR) {
+                            break;
+                        }
+                        continue;
+                    }
+
+                    for (; Head != Tail && Count != 0; ++Head, --Count) {
+                        const io_uring_cqe& Entry = Cqes[Head & *CqMask];
+                        if (Entry.res == -EINVAL || Entry.res == -EOPNOTSUPP) {
+                            ::close(static_cast<int>(Entry.user_data));
+                            bAvailable = false;
+                        }
+                    }
+                    __atomic_store_n(CqHead, Head, __ATOMIC_RELEASE);
+                }
+            }
+
+            int RingFd = -1;
+            void* SqRing = MAP_FAILED;
+            void* CqRing = MAP_FAILED;
+            std::size_t SqSize = 0;
+            std::size_t CqSize = 0;
+            io_uring_sqe* Sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+            unsigned* SqHead = nullptr;
+            unsigned* SqTail = nullptr;
+            unsigned* SqMask = nullptr;
+            unsigned* SqArray = nullptr;
+            unsigned* CqHead = nullptr;
+            unsigned* CqTail = nullptr;
+            unsigned* CqMask = nullptr;
+            io_uring_cqe* Cqes = nullptr;
+            unsigned Pending = 0;
+            bool bAvailable = false;
+        };
+    }
+
+    class UringCloseBatch {
+    public:
+        UringCloseBatch() noexcept {
+            details::UringRing::Local().Enter();
+        }
+
+        UringCloseBatch(const UringCloseBatch&) = delete;
+
+        UringCloseBatch(UringCloseBatch&&) = delete;
+
+        ~UringCloseBatch() {
+            details::UringRing::Local().Leave();
+        }
+
+        UringCloseBatch& operator=(const UringCloseBatch&) = delete;
+
+        UringCloseBatch& operator=(UringCloseBatch&&) = delete;
+
+        void Submit() noexcept {
+            details::UringRing::Local().Submit();
+        }
+    };
+
+    struct UringClose {
+        void operator()(int Fd) const noexcept {
+            if (details::UringRing::IsBatching()) {
+                details::UringRing::Local().Close(Fd);
+            } else {
+                ::close(Fd);
+            }
+        }
+
+        void operator()(const int* First, const int* Last) const noexcept {
+            if (details::UringRing::IsBatching()) {
+                details::UringRing& Ring = details::UringRing::Local();
+                for (; First != Last; ++First) {
+                    Ring.Close(*First);
+                }
+            } else {
+                for (; First != Last; ++First) {
+                    ::close(*First);
+                }
+            }
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include <utility>
+
+#include <Scope/Scope.h>
+#include <Scope/UniqueResource.h>
+
+#ifndef SCOPE_COMPILE_BENCH_COUNT
+    #define SCOPE_COMPILE_BENCH_COUNT 128
+#endif
+
+namespace {
+    int Counter = 0;
+
+    template <int I>
+    struct Deleter {
+        void operator()(int* Value) const noexcept {
+            *Value += I;
+        }
+    };
+
+    template <int I>
+    int Instantiate() {
+        stdx::UniqueResource<int*, Deleter<I>> Resource(&Counter, Deleter<I>{});
+        stdx::UniqueResource<int*, Deleter<I>> Moved = std::move(Resource);
+        Resource = std::move(Moved);
+        Resource.Reset(&Counter);
+
+        stdx::ScopeExit Scope([]() noexcept { Counter -= I; });
+        return *Resource.Get();
+    }
+
+    template <int... Is>
+    int InstantiateAll(std::integer_sequence<int, Is...>) {
+        return (Instantiate<Is>() + ...);
+    }
+}
+
+int main() {
+    return InstantiateAll(std::make_integer_sequence<int, SCOPE_COMPILE_BENCH_COUNT>{}) >= 0 ? 0 : 1;
+}
\ No newline at end of file
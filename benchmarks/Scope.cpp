@@ -0,0 +1,276 @@
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Scope/Scope.h>
+#include <Scope/ScopeStack.h>
+#include <Scope/ScopeTransaction.h>
+
+namespace {
+    std::uint64_t Counter = 0;
+
+    void Increment() noexcept {
+        ++Counter;
+    }
+
+    struct ThrowCopyCallable {
+        explicit ThrowCopyCallable(bool bThrow) noexcept : bThrow(bThrow) { }
+
+        ThrowCopyCallable(const ThrowCopyCallable& Other) : bThrow(Other.bThrow) {
+            if (bThrow) {
+                throw std::logic_error{"oops"};
+            }
+        }
+
+        void operator()() const noexcept {
+            ++Counter;
+        }
+
+        bool bThrow;
+    };
+
+    struct Lambda {
+        static auto Make() noexcept {
+            return []() noexcept { ++Counter; };
+        }
+    };
+
+    struct FunctionPointer {
+        static auto Make() noexcept {
+            auto Function = &Increment;
+            benchmark::DoNotOptimize(Function);
+            return Function;
+        }
+    };
+
+    struct Reference {
+        static auto Make() noexcept {
+            static const auto Function = []() noexcept {
+                ++Counter;
+            };
+            return std::cref(Function);
+        }
+    };
+
+    struct ThrowCopy {
+        static auto Make() noexcept {
+            return ThrowCopyCallable(false);
+        }
+    };
+
+    void Raw_ScopeConstruct(benchmark::State& State) {
+        for (auto _ : State) {
+            try {
+                benchmark::DoNotOptimize(Counter);
+            } catch (...) {
+                Increment();
+                throw;
+            }
+            Increment();
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    void Raw_ScopeRelease(benchmark::State& State) {
+        for (auto _ : State) {
+            bool bExecute = true;
+            benchmark::DoNotOptimize(bExecute);
+            bExecute = false;
+            benchmark::ClobberMemory();
+            if (bExecute) {
+                Increment();
+            }
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <template <typename> typename S, typename C>
+    void Guard_Construct(benchmark::State& State) {
+        for (auto _ : State) {
+            S<decltype(C::Make())> Scope(C::Make());
+            benchmark::DoNotOptimize(Scope);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <template <typename> typename S, typename C>
+    void Guard_Release(benchmark::State& State) {
+        for (auto _ : State) {
+            S<decltype(C::Make())> Scope(C::Make());
+            benchmark::DoNotOptimize(Scope);
+            Scope.Release();
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <template <typename> typename S, typename C>
+    void Guard_MoveConstruct(benchmark::State& State) {
+        for (auto _ : State) {
+            S<decltype(C::Make())> Scope1(C::Make());
+            benchmark::DoNotOptimize(Scope1);
+            S<decltype(C::Make())> Scope2(std::move(Scope1));
+            benchmark::DoNotOptimize(Scope2);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <template <typename> typename S, typename C>
+    void Guard_Commit(benchmark::State& State) {
+        for (auto _ : State) {
+            S<decltype(C::Make())> Scope(C::Make());
+            benchmark::DoNotOptimize(Scope);
+            Scope.Commit();
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <typename C>
+    void ScopeExit_Construct(benchmark::State& State) {
+        Guard_Construct<stdx::ScopeExit, C>(State);
+    }
+
+    template <typename C>
+    void ScopeExit_Release(benchmark::State& State) {
+        Guard_Release<stdx::ScopeExit, C>(State);
+    }
+
+    template <typename C>
+    void ScopeExit_MoveConstruct(benchmark::State& State) {
+        Guard_MoveConstruct<stdx::ScopeExit, C>(State);
+    }
+
+    void ScopeExit_InPlaceConstruct(benchmark::State& State) {
+        for (auto _ : State) {
+            auto Scope = stdx::MakeScopeExit<ThrowCopyCallable>(false);
+            benchmark::DoNotOptimize(Scope);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <typename C>
+    void ScopeSuccess_Construct(benchmark::State& State) {
+        Guard_Construct<stdx::ScopeSuccess, C>(State);
+    }
+
+    template <typename C>
+    void ScopeSuccess_Release(benchmark::State& State) {
+        Guard_Release<stdx::ScopeSuccess, C>(State);
+    }
+
+    template <typename C>
+    void ScopeSuccess_MoveConstruct(benchmark::State& State) {
+        Guard_MoveConstruct<stdx::ScopeSuccess, C>(State);
+    }
+
+    template <typename C>
+    void ScopeFail_Construct(benchmark::State& State) {
+        Guard_Construct<stdx::ScopeFail, C>(State);
+    }
+
+    template <typename C>
+    void ScopeFail_Release(benchmark::State& State) {
+        Guard_Release<stdx::ScopeFail, C>(State);
+    }
+
+    template <typename C>
+    void ScopeFail_MoveConstruct(benchmark::State& State) {
+        Guard_MoveConstruct<stdx::ScopeFail, C>(State);
+    }
+
+    template <typename C>
+    void ScopeCommit_Commit(benchmark::State& State) {
+        Guard_Commit<stdx::ScopeCommit, C>(State);
+    }
+
+    template <typename C>
+    void ScopeRollback_Construct(benchmark::State& State) {
+        Guard_Construct<stdx::ScopeRollback, C>(State);
+    }
+
+    template <typename C>
+    void ScopeRollback_Commit(benchmark::State& State) {
+        Guard_Commit<stdx::ScopeRollback, C>(State);
+    }
+
+    void ScopeFail_Stack(benchmark::State& State) {
+        for (auto _ : State) {
+            stdx::ScopeFail Scope1(Lambda::Make()), Scope2(Lambda::Make()), Scope3(Lambda::Make()), Scope4(Lambda::Make());
+            stdx::ScopeFail Scope5(Lambda::Make()), Scope6(Lambda::Make()), Scope7(Lambda::Make()), Scope8(Lambda::Make());
+            benchmark::ClobberMemory();
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    void ScopeTransaction_Stack(benchmark::State& State) {
+        for (auto _ : State) {
+            stdx::ScopeTransaction<8> Transaction;
+            for (int I = 0; I < 8; ++I) {
+                Transaction.Attach(Lambda::Make());
+            }
+            benchmark::ClobberMemory();
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    void Vector_Dynamic(benchmark::State& State) {
+        for (auto _ : State) {
+            std::vector<std::function<void()>> Stack;
+            for (auto I = State.range(0); I > 0; --I) {
+                Stack.emplace_back([I]() noexcept { Counter += std::uint64_t(I); });
+            }
+            while (!Stack.empty()) {
+                Stack.back()();
+                Stack.pop_back();
+            }
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    void ScopeStack_Dynamic(benchmark::State& State) {
+        for (auto _ : State) {
+            stdx::ScopeStack Stack;
+            for (auto I = State.range(0); I > 0; --I) {
+                Stack.Push([I]() noexcept { Counter += std::uint64_t(I); });
+            }
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+}
+
+#define SCOPE_BENCHMARK(Name)                                                                                                  \
+    BENCHMARK_TEMPLATE(Name, Lambda);                                                                                          \
+    BENCHMARK_TEMPLATE(Name, FunctionPointer);                                                                                 \
+    BENCHMARK_TEMPLATE(Name, Reference);                                                                                       \
+    BENCHMARK_TEMPLATE(Name, ThrowCopy)
+
+BENCHMARK(Raw_ScopeConstruct);
+BENCHMARK(Raw_ScopeRelease);
+
+SCOPE_BENCHMARK(ScopeExit_Construct);
+SCOPE_BENCHMARK(ScopeExit_Release);
+SCOPE_BENCHMARK(ScopeExit_MoveConstruct);
+BENCHMARK(ScopeExit_InPlaceConstruct);
+
+SCOPE_BENCHMARK(ScopeSuccess_Construct);
+SCOPE_BENCHMARK(ScopeSuccess_Release);
+SCOPE_BENCHMARK(ScopeSuccess_MoveConstruct);
+
+SCOPE_BENCHMARK(ScopeFail_Construct);
+SCOPE_BENCHMARK(ScopeFail_Release);
+SCOPE_BENCHMARK(ScopeFail_MoveConstruct);
+
+SCOPE_BENCHMARK(ScopeCommit_Commit);
+SCOPE_BENCHMARK(ScopeRollback_Construct);
+SCOPE_BENCHMARK(ScopeRollback_Commit);
+
+BENCHMARK(ScopeFail_Stack);
+BENCHMARK(ScopeTransaction_Stack);
+
+BENCHMARK(Vector_Dynamic)->Arg(4)->Arg(16)->Arg(64);
+BENCHMARK(ScopeStack_Dynamic)->Arg(4)->Arg(16)->Arg(64);
+
+#undef SCOPE_BENCHMARK
\ No newline at end of file
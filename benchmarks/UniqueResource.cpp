@@ -0,0 +1,574 @@
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#if defined(__linux__)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+#include <Scope/Arena.h>
+#include <Scope/AtomicUniqueResource.h>
+#include <Scope/LazyUniqueResource.h>
+#include <Scope/Reclaimer.h>
+#include <Scope/Relocate.h>
+#include <Scope/ResourcePool.h>
+#include <Scope/SharedResource.h>
+#include <Scope/SlotMap.h>
+#include <Scope/UniqueResource.h>
+#include <Scope/UniqueResourceSet.h>
+
+#if defined(__linux__)
+    #include <Scope/GrowableMapping.h>
+    #include <Scope/UringClose.h>
+#endif
+
+namespace {
+    std::uint64_t Counter = 0;
+
+    int Values[2] = {1, 2};
+
+    void Close(int* Value) noexcept {
+        Counter += std::uint64_t(*Value);
+    }
+
+    struct ThrowCopyCallable {
+        explicit ThrowCopyCallable(bool bThrow) noexcept : bThrow(bThrow) { }
+
+        ThrowCopyCallable(const ThrowCopyCallable& Other) : bThrow(Other.bThrow) {
+            if (bThrow) {
+                throw std::logic_error{"oops"};
+            }
+        }
+
+        ThrowCopyCallable& operator=(const ThrowCopyCallable& Other) {
+            bThrow = Other.bThrow;
+            if (bThrow) {
+                throw std::logic_error{"oops"};
+            }
+            return *this;
+        }
+
+        void operator()(int* Value) const noexcept {
+            Close(Value);
+        }
+
+        bool bThrow;
+    };
+
+    struct Lambda {
+        static auto Make() noexcept {
+            return [](int* Value) noexcept { Close(Value); };
+        }
+    };
+
+    struct FunctionPointer {
+        static auto Make() noexcept {
+            auto Function = &Close;
+            benchmark::DoNotOptimize(Function);
+            return Function;
+        }
+    };
+
+    struct Reference {
+        static auto Make() noexcept {
+            static const auto Function = [](int* Value) noexcept {
+                Close(Value);
+            };
+            return std::cref(Function);
+        }
+    };
+
+    struct ThrowCopy {
+        static auto Make() noexcept {
+            return ThrowCopyCallable(false);
+        }
+    };
+
+    int* Acquire(std::size_t Index = 0) noexcept {
+        int* Value = &Values[Index];
+        benchmark::DoNotOptimize(Value);
+        return Value;
+    }
+
+    void Raw_ResourceConstruct(benchmark::State& State) {
+        for (auto _ : State) {
+            int* Value = Acquire();
+            try {
+                benchmark::DoNotOptimize(*Value);
+            } catch (...) {
+                Close(Value);
+                throw;
+            }
+            Close(Value);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    void Raw_ResourceReset(benchmark::State& State) {
+        for (auto _ : State) {
+            int* Value = Acquire();
+            try {
+                benchmark::DoNotOptimize(*Value);
+                Close(Value);
+                Value = Acquire(1);
+                benchmark::DoNotOptimize(*Value);
+            } catch (...) {
+                Close(Value);
+                throw;
+            }
+            Close(Value);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <typename C>
+    using UniquePtr = std::unique_ptr<int, decltype(C::Make())>;
+
+    template <typename C>
+    using UniqueResource = stdx::UniqueResource<int*, decltype(C::Make())>;
+
+    template <typename C>
+    void UniquePtr_Construct(benchmark::State& State) {
+        for (auto _ : State) {
+            UniquePtr<C> Resource(Acquire(), C::Make());
+            benchmark::DoNotOptimize(Resource);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <typename C>
+    void UniquePtr_Release(benchmark::State& State) {
+        for (auto _ : State) {
+            UniquePtr<C> Resource(Acquire(), C::Make());
+            benchmark::DoNotOptimize(Resource);
+            benchmark::DoNotOptimize(Resource.release());
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <typename C>
+    void UniquePtr_MoveConstruct(benchmark::State& State) {
+        for (auto _ : State) {
+            UniquePtr<C> Resource1(Acquire(), C::Make());
+            benchmark::DoNotOptimize(Resource1);
+            UniquePtr<C> Resource2(std::move(Resource1));
+            benchmark::DoNotOptimize(Resource2);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <typename C>
+    void UniquePtr_MoveAssign(benchmark::State& State) {
+        for (auto _ : State) {
+            UniquePtr<C> Resource1(Acquire(), C::Make()), Resource2(Acquire(1), C::Make());
+            benchmark::DoNotOptimize(Resource1);
+            benchmark::DoNotOptimize(Resource2);
+            Resource2 = std::move(Resource1);
+            benchmark::DoNotOptimize(Resource2);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <typename C>
+    void UniquePtr_Reset(benchmark::State& State) {
+        for (auto _ : State) {
+            UniquePtr<C> Resource(Acquire(), C::Make());
+            benchmark::DoNotOptimize(Resource);
+            Resource.reset(Acquire(1));
+            benchmark::DoNotOptimize(Resource);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <typename C>
+    void UniqueResource_Construct(benchmark::State& State) {
+        for (auto _ : State) {
+            UniqueResource<C> Resource(Acquire(), C::Make());
+            benchmark::DoNotOptimize(Resource);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <typename C>
+    void UniqueResource_Release(benchmark::State& State) {
+        for (auto _ : State) {
+            UniqueResource<C> Resource(Acquire(), C::Make());
+            benchmark::DoNotOptimize(Resource);
+            Resource.Release();
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <typename C>
+    void UniqueResource_MoveConstruct(benchmark::State& State) {
+        for (auto _ : State) {
+            UniqueResource<C> Resource1(Acquire(), C::Make());
+            benchmark::DoNotOptimize(Resource1);
+            UniqueResource<C> Resource2(std::move(Resource1));
+            benchmark::DoNotOptimize(Resource2);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <typename C>
+    void UniqueResource_MoveAssign(benchmark::State& State) {
+        for (auto _ : State) {
+            UniqueResource<C> Resource1(Acquire(), C::Make()), Resource2(Acquire(1), C::Make());
+            benchmark::DoNotOptimize(Resource1);
+            benchmark::DoNotOptimize(Resource2);
+            Resource2 = std::move(Resource1);
+            benchmark::DoNotOptimize(Resource2);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    template <typename C>
+    void UniqueResource_Reset(benchmark::State& State) {
+        for (auto _ : State) {
+            UniqueResource<C> Resource(Acquire(), C::Make());
+            benchmark::DoNotOptimize(Resource);
+            Resource.Reset(Acquire(1));
+            benchmark::DoNotOptimize(Resource);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    void Vector_ResourceTeardown(benchmark::State& State) {
+        for (auto _ : State) {
+            std::vector<UniqueResource<FunctionPointer>> Resources;
+            Resources.reserve(std::size_t(State.range(0)));
+            for (auto I = State.range(0); I > 0; --I) {
+                Resources.emplace_back(Acquire(), FunctionPointer::Make());
+            }
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    void UniqueResourceSet_Teardown(benchmark::State& State) {
+        for (auto _ : State) {
+            stdx::UniqueResourceSet<int*, decltype(FunctionPointer::Make())> Resources(FunctionPointer::Make());
+            Resources.Reserve(std::size_t(State.range(0)));
+            for (auto I = State.range(0); I > 0; --I) {
+                Resources.Insert(Acquire());
+            }
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    void Vector_ResourceGrow(benchmark::State& State) {
+        for (auto _ : State) {
+            std::vector<stdx::UniqueResource<int*, stdx::FunctionDeleter<&Close>>> Resources;
+            for (auto I = State.range(0); I > 0; --I) {
+                Resources.emplace_back(Acquire(), stdx::FunctionDeleter<&Close>{});
+            }
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    void RelocatingVector_ResourceGrow(benchmark::State& State) {
+        for (auto _ : State) {
+            stdx::RelocatingVector<stdx::UniqueResource<int*, stdx::FunctionDeleter<&Close>>> Resources;
+            for (auto I = State.range(0); I > 0; --I) {
+                Resources.EmplaceBack(Acquire(), stdx::FunctionDeleter<&Close>{});
+            }
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    void UnorderedMap_Iterate(benchmark::State& State) {
+        std::unordered_map<std::uint64_t, UniqueResource<FunctionPointer>> Resources;
+        for (auto I = State.range(0); I > 0; --I) {
+            Resources.try_emplace(std::uint64_t(I), Acquire(), FunctionPointer::Make());
+        }
+        for (auto I = State.range(0); I > 0; I -= 2) {
+            Resources.erase(std::uint64_t(I));
+        }
+        for (auto _ : State) {
+            std::uint64_t Sum = 0;
+            for (const auto& [Key, Resource] : Resources) {
+                Sum += std::uint64_t(*Resource.Get());
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+    }
+
+    void SlotMap_Insert(benchmark::State& State) {
+        for (auto _ : State) {
+            stdx::SlotMap<int*, decltype(FunctionPointer::Make())> Resources(FunctionPointer::Make());
+            for (auto I = State.range(0); I > 0; --I) {
+                benchmark::DoNotOptimize(Resources.Insert(Acquire()));
+            }
+        }
+    }
+
+    void SlotMap_Iterate(benchmark::State& State) {
+        stdx::SlotMap<int*, decltype(FunctionPointer::Make())> Resources(FunctionPointer::Make());
+        std::vector<std::uint64_t> Handles;
+        for (auto I = State.range(0); I > 0; --I) {
+            Handles.push_back(Resources.Insert(Acquire()));
+        }
+        for (std::size_t I = 0; I < Handles.size(); I += 2) {
+            Resources.Erase(Handles[I]);
+        }
+        for (auto _ : State) {
+            std::uint64_t Sum = 0;
+            for (int* Resource : Resources) {
+                Sum += std::uint64_t(*Resource);
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+    }
+
+    void SlowClose(int* Value) noexcept {
+        for (int I = 0; I < 256; ++I) {
+            benchmark::DoNotOptimize(*Value);
+        }
+    }
+
+    void UniqueResource_SlowReset(benchmark::State& State) {
+        for (auto _ : State) {
+            stdx::UniqueResource Resource(Acquire(), &SlowClose);
+            benchmark::DoNotOptimize(Resource);
+        }
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    void UniqueResource_DeferredSlowReset(benchmark::State& State) {
+        stdx::Reclaimer Reclaimer;
+        for (auto _ : State) {
+            stdx::UniqueResource Resource(Acquire(), stdx::DeferredDeleter(&SlowClose, Reclaimer));
+            benchmark::DoNotOptimize(Resource);
+        }
+        Reclaimer.Flush();
+        benchmark::DoNotOptimize(Counter);
+    }
+
+    void Allocate_Buffer(benchmark::State& State) {
+        for (auto _ : State) {
+            auto Buffer = std::make_unique<std::vector<char>>(std::size_t(State.range(0)));
+            benchmark::DoNotOptimize(Buffer->data());
+        }
+    }
+
+    void ResourcePool_Buffer(benchmark::State& State) {
+        stdx::ResourcePool<std::vector<char>> Pool([&State]() { return std::vector<char>(std::size_t(State.range(0))); });
+        for (auto _ : State) {
+            auto Buffer = Pool.Acquire();
+            benchmark::DoNotOptimize(Buffer->data());
+        }
+    }
+
+    template <typename F>
+    void Request(std::pmr::memory_resource* Resource, F&& Sink) {
+        std::pmr::vector<std::pmr::vector<int>> Rows(Resource);
+        for (int I = 0; I < 32; ++I) {
+            auto& Row = Rows.emplace_back();
+            for (int J = 0; J < 16; ++J) {
+                Row.push_back(J);
+            }
+        }
+        Sink(Rows);
+    }
+
+    void NewDelete_Request(benchmark::State& State) {
+        for (auto _ : State) {
+            Request(std::pmr::new_delete_resource(), [](auto& Rows) { benchmark::DoNotOptimize(Rows.data()); });
+        }
+    }
+
+    void Arena_Request(benchmark::State& State) {
+        stdx::Arena Region;
+        for (auto _ : State) {
+            auto Checkpoint = Region.Checkpoint();
+            Request(&Region, [](auto& Rows) { benchmark::DoNotOptimize(Rows.data()); });
+        }
+    }
+
+    void SharedPtr_Copy(benchmark::State& State) {
+        static const std::shared_ptr<int> Resource(Acquire(), FunctionPointer::Make());
+        for (auto _ : State) {
+            std::shared_ptr<int> Copy = Resource;
+            benchmark::DoNotOptimize(Copy);
+        }
+    }
+
+    template <typename C>
+    void SharedResource_Copy(benchmark::State& State) {
+        static const auto Resource = stdx::MakeSharedResource<C>(Acquire(), FunctionPointer::Make());
+        for (auto _ : State) {
+            auto Copy = Resource;
+            benchmark::DoNotOptimize(Copy);
+        }
+    }
+
+    void Mutex_LazyGet(benchmark::State& State) {
+        static std::mutex Mutex;
+        static std::optional<UniqueResource<FunctionPointer>> Resource;
+        for (auto _ : State) {
+            std::lock_guard Lock(Mutex);
+            if (!Resource) {
+                Resource.emplace(Acquire(), FunctionPointer::Make());
+            }
+            benchmark::DoNotOptimize(Resource->Get());
+        }
+    }
+
+    void LazyUniqueResource_Get(benchmark::State& State) {
+        static stdx::LazyUniqueResource Resource([]() noexcept { return Acquire(); }, FunctionPointer::Make());
+        for (auto _ : State) {
+            benchmark::DoNotOptimize(Resource.Get());
+        }
+    }
+
+    void Mutex_SharedGet(benchmark::State& State) {
+        static std::mutex Mutex;
+        static UniqueResource<FunctionPointer> Resource(Acquire(), FunctionPointer::Make());
+        for (auto _ : State) {
+            std::lock_guard Lock(Mutex);
+            benchmark::DoNotOptimize(Resource.Get());
+        }
+    }
+
+    void AtomicUniqueResource_Load(benchmark::State& State) {
+        static stdx::EpochDomain Domain;
+        static stdx::AtomicUniqueResource Resource(UniqueResource<FunctionPointer>(Acquire(), FunctionPointer::Make()));
+        stdx::EpochDomain::Participant Reader(Domain);
+        for (auto _ : State) {
+            auto Guard = Reader.Enter();
+            benchmark::DoNotOptimize(Resource.Load(Guard)->Get());
+        }
+    }
+
+#if defined(__linux__)
+    struct SyncClose {
+        void operator()(int Fd) const noexcept {
+            ::close(Fd);
+        }
+    };
+
+    template <typename D, bool bBatch>
+    void Fd_Teardown(benchmark::State& State) {
+        for (auto _ : State) {
+            std::vector<stdx::UniqueResource<int, D>> Resources;
+            Resources.reserve(std::size_t(State.range(0)));
+            for (auto I = State.range(0); I > 0; --I) {
+                Resources.emplace_back(::open("/dev/null", O_RDONLY | O_CLOEXEC), D());
+            }
+            if constexpr (bBatch) {
+                stdx::UringCloseBatch Batch;
+                Resources.clear();
+            } else {
+                Resources.clear();
+            }
+        }
+    }
+
+    void Vector_Grow(benchmark::State& State) {
+        for (auto _ : State) {
+            std::vector<char> Buffer(4096);
+            while (Buffer.size() < std::size_t(State.range(0))) {
+                Buffer.resize(2 * Buffer.size());
+            }
+            benchmark::DoNotOptimize(Buffer.data());
+        }
+    }
+
+    template <stdx::GrowPolicy Policy>
+    void GrowableMapping_Grow(benchmark::State& State) {
+        for (auto _ : State) {
+            auto Arena = stdx::GrowableMapping<Policy>::Reserve(std::size_t(State.range(0)), 4096);
+            for (std::size_t Size = 4096; Size < std::size_t(State.range(0)); Size *= 2) {
+                Arena.Grow(2 * Size);
+                Arena.Data()[Size] = std::byte{1};
+            }
+            benchmark::DoNotOptimize(Arena.Data());
+        }
+    }
+
+    void Sync_FdTeardown(benchmark::State& State) {
+        Fd_Teardown<SyncClose, false>(State);
+    }
+
+    void Uring_FdTeardown(benchmark::State& State) {
+        Fd_Teardown<stdx::UringClose, true>(State);
+    }
+#endif
+}
+
+#define RESOURCE_BENCHMARK(Name)                                                                                               \
+    BENCHMARK_TEMPLATE(Name, Lambda);                                                                                          \
+    BENCHMARK_TEMPLATE(Name, FunctionPointer);                                                                                 \
+    BENCHMARK_TEMPLATE(Name, Reference);                                                                                       \
+    BENCHMARK_TEMPLATE(Name, ThrowCopy)
+
+#define ASSIGNABLE_RESOURCE_BENCHMARK(Name)                                                                                    \
+    BENCHMARK_TEMPLATE(Name, FunctionPointer);                                                                                 \
+    BENCHMARK_TEMPLATE(Name, Reference);                                                                                       \
+    BENCHMARK_TEMPLATE(Name, ThrowCopy)
+
+BENCHMARK(Raw_ResourceConstruct);
+BENCHMARK(Raw_ResourceReset);
+
+RESOURCE_BENCHMARK(UniquePtr_Construct);
+RESOURCE_BENCHMARK(UniquePtr_Release);
+RESOURCE_BENCHMARK(UniquePtr_MoveConstruct);
+ASSIGNABLE_RESOURCE_BENCHMARK(UniquePtr_MoveAssign);
+RESOURCE_BENCHMARK(UniquePtr_Reset);
+
+RESOURCE_BENCHMARK(UniqueResource_Construct);
+RESOURCE_BENCHMARK(UniqueResource_Release);
+RESOURCE_BENCHMARK(UniqueResource_MoveConstruct);
+ASSIGNABLE_RESOURCE_BENCHMARK(UniqueResource_MoveAssign);
+RESOURCE_BENCHMARK(UniqueResource_Reset);
+
+BENCHMARK(Vector_ResourceTeardown)->Arg(64)->Arg(1024);
+BENCHMARK(UniqueResourceSet_Teardown)->Arg(64)->Arg(1024);
+
+BENCHMARK(Vector_ResourceGrow)->Arg(64)->Arg(1024);
+BENCHMARK(RelocatingVector_ResourceGrow)->Arg(64)->Arg(1024);
+
+BENCHMARK(UnorderedMap_Iterate)->Arg(1024)->Arg(16384);
+BENCHMARK(SlotMap_Insert)->Arg(1024)->Arg(1 << 18);
+BENCHMARK(SlotMap_Iterate)->Arg(1024)->Arg(16384);
+
+BENCHMARK(UniqueResource_SlowReset);
+BENCHMARK(UniqueResource_DeferredSlowReset);
+
+BENCHMARK(Allocate_Buffer)->Arg(4096)->Arg(1 << 20);
+BENCHMARK(ResourcePool_Buffer)->Arg(4096)->Arg(1 << 20);
+
+BENCHMARK(NewDelete_Request);
+BENCHMARK(Arena_Request);
+
+BENCHMARK(SharedPtr_Copy)->Threads(1)->Threads(4);
+BENCHMARK_TEMPLATE(SharedResource_Copy, stdx::AtomicRefCount)->Threads(1)->Threads(4);
+BENCHMARK_TEMPLATE(SharedResource_Copy, stdx::LocalRefCount)->Threads(1);
+BENCHMARK_TEMPLATE(SharedResource_Copy, stdx::ShardedRefCount<>)->Threads(1)->Threads(4);
+
+BENCHMARK(Mutex_LazyGet)->Threads(1)->Threads(4);
+BENCHMARK(LazyUniqueResource_Get)->Threads(1)->Threads(4);
+
+BENCHMARK(Mutex_SharedGet)->Threads(1)->Threads(4);
+BENCHMARK(AtomicUniqueResource_Load)->Threads(1)->Threads(4);
+
+#if defined(__linux__)
+BENCHMARK(Vector_Grow)->Arg(1 << 20)->Arg(64 << 20);
+BENCHMARK_TEMPLATE(GrowableMapping_Grow, stdx::GrowPolicy::Fixed)->Arg(1 << 20)->Arg(64 << 20);
+BENCHMARK_TEMPLATE(GrowableMapping_Grow, stdx::GrowPolicy::MayMove)->Arg(1 << 20)->Arg(64 << 20);
+
+BENCHMARK(Sync_FdTeardown)->Arg(64)->Arg(256);
+BENCHMARK(Uring_FdTeardown)->Arg(64)->Arg(256);
+#endif
+
+#undef ASSIGNABLE_RESOURCE_BENCHMARK
+#undef RESOURCE_BENCHMARK
\ No newline at end of file
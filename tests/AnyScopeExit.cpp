@@ -0,0 +1,145 @@
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <Scope/AnyScopeExit.h>
+
+namespace {
+    struct ThrowCopyCallable {
+        explicit ThrowCopyCallable(bool bThrow, std::uint8_t& bWasCalled) noexcept : bThrow(bThrow), bWasCalled(bWasCalled) { }
+
+        ThrowCopyCallable(const ThrowCopyCallable& Other) : bThrow(Other.bThrow), bWasCalled(Other.bWasCalled) {
+            if (bThrow) {
+                throw std::logic_error{"oops"};
+            }
+        }
+
+        void operator()() const noexcept {
+            ++bWasCalled;
+        }
+
+        bool bThrow;
+        std::uint8_t& bWasCalled;
+    };
+
+    struct ToggleCopyCallable {
+        explicit ToggleCopyCallable(const bool& bThrow, std::uint8_t& bWasCalled) noexcept : bThrow(bThrow), bWasCalled(bWasCalled) { }
+
+        ToggleCopyCallable(const ToggleCopyCallable& Other) : bThrow(Other.bThrow), bWasCalled(Other.bWasCalled) {
+            if (bThrow) {
+                throw std::logic_error{"oops"};
+            }
+        }
+
+        void operator()() const noexcept {
+            ++bWasCalled;
+        }
+
+        const bool& bThrow;
+        std::uint8_t& bWasCalled;
+    };
+
+    stdx::AnyScopeExit Acquire(std::uint8_t& bWasCalled) {
+        return stdx::AnyScopeExit([&bWasCalled]() noexcept { ++bWasCalled; });
+    }
+}
+
+namespace stdx::tests {
+    TEST(Scope, AnyScopeExit) {
+        {
+            bool bWasCalled = false;
+            {
+                AnyScopeExit Scope([&bWasCalled]() noexcept { bWasCalled = true; });
+            }
+            ASSERT_TRUE(bWasCalled);
+        }
+
+        {
+            bool bWasCalled = false;
+            {
+                AnyScopeExit Scope([&bWasCalled]() noexcept { bWasCalled = true; });
+                Scope.Release();
+            }
+            ASSERT_FALSE(bWasCalled);
+        }
+
+        {
+            AnyScopeExit Scope;
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                AnyScopeExit Scope = Acquire(bWasCalled);
+                ASSERT_EQ(bWasCalled, 0);
+            }
+            ASSERT_EQ(bWasCalled, 1);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                AnyScopeExit Scope1([Value = std::make_unique<int>(1), &bWasCalled]() noexcept { bWasCalled += std::uint8_t(*Value); });
+                AnyScopeExit Scope2 = std::move(Scope1);
+            }
+            ASSERT_EQ(bWasCalled, 1);
+        }
+
+        {
+            bool bWasCalled = false;
+            const auto Callable = [&bWasCalled]() noexcept {
+                bWasCalled = true;
+            };
+            { AnyScopeExit Scope(std::cref(Callable)); }
+            ASSERT_TRUE(bWasCalled);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            ThrowCopyCallable Callable(true, bWasCalled);
+            { ASSERT_THROW(AnyScopeExit Scope(Callable), std::logic_error); }
+            ASSERT_EQ(bWasCalled, 1);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            ThrowCopyCallable Callable(false, bWasCalled);
+            {
+                AnyScopeExit Scope1(Callable);
+                Scope1.Release();
+                AnyScopeExit Scope2(std::move(Scope1));
+            }
+            ASSERT_EQ(bWasCalled, 0);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            bool bThrow = false;
+            ToggleCopyCallable Callable(bThrow, bWasCalled);
+            {
+                AnyScopeExit Scope1(Callable);
+                bThrow = true;
+                ASSERT_THROW(AnyScopeExit Scope2(std::move(Scope1)), std::logic_error);
+            }
+            ASSERT_EQ(bWasCalled, 1);
+        }
+
+        {
+            static_assert(std::is_constructible_v<AnyScopeExit, void (*)() noexcept>);
+            static_assert(!std::is_constructible_v<AnyScopeExit, void (*)()>);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                BasicAnyScopeExit<64> Scope([Padding = std::array<char, 48>{}, &bWasCalled]() noexcept { bWasCalled += Padding[0] + 1; });
+            }
+            ASSERT_EQ(bWasCalled, 1);
+        }
+    }
+}
\ No newline at end of file
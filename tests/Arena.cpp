@@ -0,0 +1,141 @@
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Scope/Arena.h>
+
+namespace {
+    class CountingResource final : public std::pmr::memory_resource {
+    public:
+        int Allocations = 0;
+        int Deallocations = 0;
+
+    private:
+        void* do_allocate(std::size_t Size, std::size_t Alignment) override {
+            ++Allocations;
+            return std::pmr::new_delete_resource()->allocate(Size, Alignment);
+        }
+
+        void do_deallocate(void* Pointer, std::size_t Size, std::size_t Alignment) override {
+            ++Deallocations;
+            std::pmr::new_delete_resource()->deallocate(Pointer, Size, Alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& Other) const noexcept override {
+            return this == &Other;
+        }
+    };
+}
+
+namespace stdx::tests {
+    TEST(Scope, Arena) {
+        {
+            CountingResource Upstream;
+            {
+                Arena Region(4096, &Upstream);
+                std::pmr::vector<std::pmr::string> Strings(&Region);
+                for (int I = 0; I < 100; ++I) {
+                    Strings.emplace_back(std::string(64, char('a' + I % 26)));
+                }
+                ASSERT_EQ(std::string_view(Strings[42]), std::string(64, char('a' + 42 % 26)));
+                ASSERT_GT(Upstream.Allocations, 1);
+                ASSERT_EQ(Upstream.Deallocations, 0);
+            }
+            ASSERT_EQ(Upstream.Allocations, Upstream.Deallocations);
+        }
+
+        {
+            CountingResource Upstream;
+            Arena Region(1024, &Upstream);
+            void* Before = Region.Allocate(16);
+            void* Rewound = nullptr;
+            {
+                auto Checkpoint = Region.Checkpoint();
+                Rewound = Region.Allocate(100);
+                for (int I = 0; I < 64; ++I) {
+                    (void) Region.Allocate(128);
+                }
+            }
+            const int Allocations = Upstream.Allocations;
+            ASSERT_EQ(Region.Allocate(100), Rewound);
+            ASSERT_NE(Before, Rewound);
+
+            for (int I = 0; I < 64; ++I) {
+                (void) Region.Allocate(128);
+            }
+            ASSERT_EQ(Upstream.Allocations, Allocations);
+
+            Region.Reset();
+            ASSERT_EQ(Region.Allocate(16), Before);
+
+            Region.Release();
+            ASSERT_EQ(Upstream.Allocations, Upstream.Deallocations);
+        }
+
+        {
+            alignas(std::max_align_t) std::byte Buffer[4096];
+            Arena Region(Buffer, sizeof(Buffer), 4096, std::pmr::null_memory_resource());
+            std::pmr::vector<int> Values(&Region);
+            Values.reserve(512);
+            for (int I = 0; I < 512; ++I) {
+                Values.push_back(I);
+            }
+            const auto Address = reinterpret_cast<std::uintptr_t>(Values.data());
+            ASSERT_GE(Address, reinterpret_cast<std::uintptr_t>(Buffer));
+            ASSERT_LT(Address, reinterpret_cast<std::uintptr_t>(Buffer + sizeof(Buffer)));
+            ASSERT_THROW((void) Region.Allocate(8192), std::bad_alloc);
+        }
+
+        {
+            alignas(std::max_align_t) std::byte Buffer[1024];
+            CountingResource Upstream;
+            Arena Region(Buffer, sizeof(Buffer), 256, &Upstream);
+            for (int I = 0; I < 16; ++I) {
+                (void) Region.Allocate(128);
+            }
+            ASSERT_GT(Upstream.Allocations, 0);
+
+            Region.Release();
+            ASSERT_EQ(Upstream.Allocations, Upstream.Deallocations);
+
+            const auto Address = reinterpret_cast<std::uintptr_t>(Region.Allocate(64, 8));
+            ASSERT_GE(Address, reinterpret_cast<std::uintptr_t>(Buffer));
+            ASSERT_LT(Address, reinterpret_cast<std::uintptr_t>(Buffer + sizeof(Buffer)));
+        }
+
+        {
+            alignas(std::max_align_t) std::byte Buffer[1024];
+            Arena Region(Buffer, sizeof(Buffer), 256, std::pmr::null_memory_resource());
+            (void) Region.Allocate(512);
+            Region.Release();
+
+            const auto Address = reinterpret_cast<std::uintptr_t>(Region.Allocate(64, 8));
+            ASSERT_GE(Address, reinterpret_cast<std::uintptr_t>(Buffer));
+            ASSERT_LT(Address, reinterpret_cast<std::uintptr_t>(Buffer + sizeof(Buffer)));
+        }
+
+        {
+            CountingResource Upstream;
+            Arena Region(256, &Upstream);
+            ASSERT_THROW((void) Region.Allocate(std::numeric_limits<std::size_t>::max() - 8, 16), std::bad_alloc);
+            ASSERT_THROW((void) Region.Allocate(std::numeric_limits<std::size_t>::max(), 1), std::bad_alloc);
+            ASSERT_EQ(Upstream.Allocations, 0);
+        }
+
+        {
+            Arena Region(256);
+            for (std::size_t Alignment = 1; Alignment <= 4096; Alignment *= 2) {
+                void* Pointer = Region.Allocate(3, Alignment);
+                ASSERT_EQ(reinterpret_cast<std::uintptr_t>(Pointer) % Alignment, 0);
+            }
+            ASSERT_NE(Region.Allocate(0), nullptr);
+            ASSERT_TRUE(Region.is_equal(Region));
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Scope/AtomicUniqueResource.h>
+
+namespace {
+    struct Box {
+        int Value;
+        std::atomic<bool> bDead;
+    };
+
+    void Kill(Box* Value) noexcept {
+        Value->bDead.store(true, std::memory_order_relaxed);
+        delete Value;
+    }
+
+    std::atomic<int> Closed = 0;
+
+    void Close(int Value) noexcept {
+        Closed += Value;
+    }
+}
+
+namespace stdx::tests {
+    TEST(Scope, AtomicUniqueResource) {
+        using Resource = UniqueResource<int, void (*)(int) noexcept>;
+
+        {
+            Closed = 0;
+            EpochDomain Domain;
+            EpochDomain::Participant Writer(Domain);
+            {
+                AtomicUniqueResource<int, void (*)(int) noexcept> Shared;
+                {
+                    auto Guard = Writer.Enter();
+                    ASSERT_EQ(Shared.Load(Guard), nullptr);
+
+                    Shared.Store(Writer, Resource(1, &Close));
+                    ASSERT_EQ(Shared.Load(Guard)->Get(), 1);
+                }
+
+                {
+                    auto Guard = Writer.Enter();
+                    const Resource* Previous = Shared.Exchange(Writer, Resource(2, &Close));
+                    ASSERT_EQ(Previous->Get(), 1);
+                    ASSERT_EQ(Shared.Load(Guard)->Get(), 2);
+                    Writer.Collect();
+                    Writer.Collect();
+                    ASSERT_EQ(Closed, 0);
+                }
+                Writer.Synchronize();
+                ASSERT_EQ(Closed, 1);
+            }
+            ASSERT_EQ(Closed, 3);
+        }
+
+        {
+            Closed = 0;
+            EpochDomain Domain;
+            EpochDomain::Participant Writer(Domain);
+            {
+                AtomicUniqueResource Shared(Resource(1, &Close));
+                {
+                    auto Guard = Writer.Enter();
+                    const Resource* Expected = Shared.Load(Guard);
+
+                    Resource Desired(4, &Close);
+                    ASSERT_TRUE(Shared.CompareExchange(Writer, Expected, std::move(Desired)));
+                    ASSERT_FALSE(Desired.IsEngaged());
+                    ASSERT_EQ(Shared.Load(Guard)->Get(), 4);
+
+                    Resource Other(8, &Close);
+                    ASSERT_FALSE(Shared.CompareExchange(Writer, Expected, std::move(Other)));
+                    ASSERT_EQ(Expected, Shared.Load(Guard));
+                    ASSERT_TRUE(Other.IsEngaged());
+                    ASSERT_EQ(Other.Get(), 8);
+                    ASSERT_TRUE(Shared.CompareExchange(Writer, Expected, std::move(Other)));
+                    ASSERT_EQ(Shared.Load(Guard)->Get(), 8);
+
+                    Shared.Reset(Writer);
+                    ASSERT_EQ(Shared.Load(Guard), nullptr);
+                }
+                Writer.Synchronize();
+                ASSERT_EQ(Closed, 13);
+            }
+            ASSERT_EQ(Closed, 13);
+        }
+
+        {
+            Closed = 0;
+            EpochDomain Domain;
+            EpochDomain::Participant Writer(Domain);
+            {
+                auto Counter = [Sum = &Closed](int Value) noexcept { *Sum += Value; };
+                using Counted = UniqueResource<int, decltype(Counter)>;
+                static_assert(!std::is_move_assignable_v<Counted>);
+
+                AtomicUniqueResource Shared(Counted(1, Counter));
+                const Counted* Expected = nullptr;
+
+                Counted Desired(2, Counter);
+                {
+                    auto Guard = Writer.Enter();
+                    ASSERT_FALSE(Shared.CompareExchange(Writer, Expected, std::move(Desired)));
+                    ASSERT_EQ(Expected, Shared.Load(Guard));
+                    ASSERT_TRUE(Desired.IsEngaged());
+                    ASSERT_EQ(Desired.Get(), 2);
+                }
+                Writer.Synchronize();
+                ASSERT_EQ(Closed, 0);
+
+                {
+                    auto Guard = Writer.Enter();
+                    ASSERT_TRUE(Shared.CompareExchange(Writer, Expected, std::move(Desired)));
+                    ASSERT_FALSE(Desired.IsEngaged());
+                    ASSERT_EQ(Shared.Load(Guard)->Get(), 2);
+                }
+                Writer.Synchronize();
+                ASSERT_EQ(Closed, 1);
+            }
+            ASSERT_EQ(Closed, 3);
+        }
+
+        {
+            EpochDomain Domain(16);
+            AtomicUniqueResource Shared(UniqueResource(new Box{0, false}, &Kill));
+            std::atomic<bool> bStop = false;
+
+            std::vector<std::thread> Readers;
+            for (int I = 0; I < 3; ++I) {
+                Readers.emplace_back([&Domain, &Shared, &bStop]() {
+                    EpochDomain::Participant Participant(Domain);
+                    while (!bStop.load(std::memory_order_relaxed)) {
+                        auto Guard = Participant.Enter();
+                        ASSERT_FALSE(Shared.Load(Guard)->Get()->bDead.load(std::memory_order_relaxed));
+                    }
+                });
+            }
+
+            {
+                EpochDomain::Participant Writer(Domain);
+                for (int I = 1; I <= 2000; ++I) {
+                    if (I % 2) {
+                        Shared.Store(Writer, UniqueResource(new Box{I, false}, &Kill));
+                    } else {
+                        auto Guard = Writer.Enter();
+                        const auto* Expected = Shared.Load(Guard);
+                        while (!Shared.CompareExchange(Writer, Expected, UniqueResource(new Box{I, false}, &Kill))) {
+                        }
+                    }
+                }
+                bStop = true;
+                for (auto& Reader : Readers) {
+                    Reader.join();
+                }
+                Writer.Synchronize();
+            }
+            EpochDomain::Participant Reader(Domain);
+            auto Guard = Reader.Enter();
+            ASSERT_EQ(Shared.Load(Guard)->Get()->Value, 2000);
+        }
+    }
+}
\ No newline at end of file
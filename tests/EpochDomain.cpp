@@ -0,0 +1,129 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Scope/EpochDomain.h>
+#include <Scope/UniqueResource.h>
+
+namespace {
+    struct Box {
+        int Value;
+        std::atomic<bool> bDead;
+    };
+
+    void Kill(Box* Value) noexcept {
+        Value->bDead.store(true, std::memory_order_relaxed);
+        delete Value;
+    }
+
+    void Increment(std::atomic<int>* Value) noexcept {
+        ++*Value;
+    }
+}
+
+namespace stdx::tests {
+    TEST(Scope, EpochDomain) {
+        {
+            std::atomic<int> Value = 0;
+            EpochDomain Domain;
+            EpochDomain::Participant Participant(Domain);
+            {
+                auto Guard = Participant.Enter();
+                Participant.Retire(UniqueResource(&Value, &Increment));
+                for (int I = 0; I < 4; ++I) {
+                    Participant.Collect();
+                }
+                ASSERT_EQ(Value, 0);
+                ASSERT_EQ(Participant.GetRetired(), 1);
+                {
+                    auto Nested = Participant.Enter();
+                    ASSERT_FALSE(Participant.Synchronize());
+                }
+                ASSERT_FALSE(Participant.Synchronize());
+                ASSERT_EQ(Participant.GetRetired(), 1);
+            }
+            ASSERT_TRUE(Participant.Synchronize());
+            ASSERT_EQ(Value, 1);
+            ASSERT_EQ(Participant.GetRetired(), 0);
+        }
+
+        {
+            std::atomic<int> Value = 0;
+            std::atomic<int> Step = 0;
+            EpochDomain Domain;
+            EpochDomain::Participant Writer(Domain);
+
+            std::thread Reader([&Domain, &Step]() {
+                EpochDomain::Participant Participant(Domain);
+                auto Guard = Participant.Enter();
+                Step = 1;
+                while (Step != 2) {
+                    std::this_thread::yield();
+                }
+            });
+
+            while (Step != 1) {
+                std::this_thread::yield();
+            }
+            Writer.Retire(UniqueResource(&Value, &Increment));
+            for (int I = 0; I < 4; ++I) {
+                Writer.Collect();
+            }
+            ASSERT_EQ(Value, 0);
+
+            Step = 2;
+            Reader.join();
+            Writer.Synchronize();
+            ASSERT_EQ(Value, 1);
+        }
+
+        {
+            std::atomic<int> Value = 0;
+            {
+                EpochDomain Domain(4);
+                EpochDomain::Participant Participant(Domain);
+                for (int I = 0; I < 16; ++I) {
+                    Participant.Retire(UniqueResource(&Value, &Increment));
+                }
+                ASSERT_GT(Value, 0);
+                ASSERT_LT(Participant.GetRetired(), 16);
+            }
+            ASSERT_EQ(Value, 16);
+        }
+
+        {
+            EpochDomain Domain(16);
+            std::atomic<Box*> Shared = new Box{0, false};
+            std::atomic<bool> bStop = false;
+
+            std::vector<std::thread> Readers;
+            for (int I = 0; I < 3; ++I) {
+                Readers.emplace_back([&Domain, &Shared, &bStop]() {
+                    EpochDomain::Participant Participant(Domain);
+                    while (!bStop.load(std::memory_order_relaxed)) {
+                        auto Guard = Participant.Enter();
+                        Box* Value = Shared.load(std::memory_order_acquire);
+                        ASSERT_FALSE(Value->bDead.load(std::memory_order_relaxed));
+                    }
+                });
+            }
+
+            {
+                EpochDomain::Participant Writer(Domain);
+                for (int I = 1; I <= 2000; ++I) {
+                    Box* Previous = Shared.exchange(new Box{I, false}, std::memory_order_acq_rel);
+                    Writer.Retire(UniqueResource(Previous, &Kill));
+                }
+                bStop = true;
+                for (auto& Reader : Readers) {
+                    Reader.join();
+                }
+                Writer.Synchronize();
+            }
+
+            Kill(Shared.load());
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include <cerrno>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <Scope/FdPassing.h>
+
+namespace {
+    struct SocketPair {
+        SocketPair() noexcept {
+            int Fds[2];
+            if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, Fds) == 0) {
+                First = stdx::UniqueFd(Fds[0]);
+                Second = stdx::UniqueFd(Fds[1]);
+            }
+        }
+
+        stdx::UniqueFd First;
+        stdx::UniqueFd Second;
+    };
+}
+
+namespace stdx::tests {
+    TEST(Scope, FdPassing) {
+        {
+            SocketPair Sockets;
+            ASSERT_TRUE(Sockets.First.IsEngaged());
+
+            std::vector<UniqueFd> Readers, Writers;
+            for (int I = 0; I < 3; ++I) {
+                int Pipe[2];
+                ASSERT_EQ(::pipe2(Pipe, O_CLOEXEC), 0);
+                Readers.emplace_back(Pipe[0]);
+                Writers.emplace_back(Pipe[1]);
+            }
+
+            ASSERT_EQ(SendFds(Sockets.First.Get(), Writers.data(), Writers.size()), 3);
+            for (const auto& Writer : Writers) {
+                ASSERT_FALSE(Writer.IsEngaged());
+            }
+
+            UniqueFd Received[4];
+            ASSERT_EQ(ReceiveFds(Sockets.Second.Get(), Received, 4), 3);
+            ASSERT_FALSE(Received[3].IsEngaged());
+            for (int I = 0; I < 3; ++I) {
+                ASSERT_TRUE(Received[I].IsEngaged());
+                ASSERT_TRUE(::fcntl(Received[I].Get(), F_GETFD) & FD_CLOEXEC);
+                const char Byte = char('a' + I);
+                ASSERT_EQ(::write(Received[I].Get(), &Byte, 1), 1);
+                Received[I].Reset();
+
+                char Read = 0;
+                ASSERT_EQ(::read(Readers[std::size_t(I)].Get(), &Read, 1), 1);
+                ASSERT_EQ(Read, Byte);
+                ASSERT_EQ(::read(Readers[std::size_t(I)].Get(), &Read, 1), 0);
+            }
+        }
+
+        {
+            SocketPair Sockets;
+            std::vector<UniqueFd> Fds;
+            for (int I = 0; I < 300; ++I) {
+                Fds.push_back(OpenFd("/dev/null", O_RDONLY | O_CLOEXEC));
+            }
+            ASSERT_EQ(SendFds(Sockets.First.Get(), Fds.data(), Fds.size()), 300);
+
+            std::vector<UniqueFd> Received(300);
+            ASSERT_EQ(ReceiveFds(Sockets.Second.Get(), Received.data(), Received.size()), 253);
+            ASSERT_EQ(ReceiveFds(Sockets.Second.Get(), Received.data() + 253, Received.size() - 253), 47);
+            for (const auto& Fd : Received) {
+                ASSERT_TRUE(Fd.IsEngaged());
+            }
+        }
+
+        {
+            SocketPair Sockets;
+            UniqueFd Fds[4];
+            for (auto& Fd : Fds) {
+                Fd = OpenFd("/dev/null", O_RDONLY | O_CLOEXEC);
+            }
+            ASSERT_EQ(SendFds(Sockets.First.Get(), Fds, 4), 4);
+
+            errno = 0;
+            UniqueFd Received[2];
+            ASSERT_EQ(ReceiveFds(Sockets.Second.Get(), Received, 2), -1);
+            ASSERT_EQ(errno, EMSGSIZE);
+            ASSERT_TRUE(Received[0].IsEngaged());
+            ASSERT_TRUE(Received[1].IsEngaged());
+        }
+
+        {
+            SocketPair Sockets;
+            Sockets.Second.Reset();
+
+            UniqueFd Fd = OpenFd("/dev/null", O_RDONLY | O_CLOEXEC);
+            errno = 0;
+            ASSERT_FALSE(SendFd(Sockets.First.Get(), Fd));
+            ASSERT_EQ(errno, EPIPE);
+            ASSERT_TRUE(Fd.IsEngaged());
+        }
+
+        {
+            SocketPair Sockets;
+            UniqueFd Fd = OpenFd("/dev/null", O_RDONLY | O_CLOEXEC);
+            ASSERT_TRUE(SendFd(Sockets.First.Get(), Fd));
+            ASSERT_FALSE(Fd.IsEngaged());
+            ASSERT_TRUE(ReceiveFd(Sockets.Second.Get()).IsEngaged());
+
+            Sockets.First.Reset();
+            ASSERT_FALSE(ReceiveFd(Sockets.Second.Get()).IsEngaged());
+        }
+    }
+}
\ No newline at end of file
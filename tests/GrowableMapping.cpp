@@ -0,0 +1,104 @@
+#include <cerrno>
+#include <cstddef>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <Scope/GrowableMapping.h>
+
+namespace {
+    bool IsMapped(void* Address) noexcept {
+        unsigned char Vector;
+        return ::mincore(Address, std::size_t(::sysconf(_SC_PAGESIZE)), &Vector) == 0;
+    }
+
+    void Fill(std::byte* Data, std::size_t First, std::size_t Last) noexcept {
+        for (std::size_t Index = First; Index < Last; ++Index) {
+            Data[Index] = std::byte(Index % 251);
+        }
+    }
+
+    bool Check(const std::byte* Data, std::size_t Size) noexcept {
+        for (std::size_t Index = 0; Index < Size; ++Index) {
+            if (Data[Index] != std::byte(Index % 251)) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+namespace stdx::tests {
+    TEST(Scope, GrowableMapping) {
+        {
+            auto Arena = GrowableMapping<GrowPolicy::Fixed>::Reserve(64 << 20, 1);
+            ASSERT_TRUE(Arena.IsEngaged());
+            ASSERT_EQ(Arena.GetCapacity(), 64 << 20);
+            std::byte* const Base = Arena.Data();
+
+            std::size_t Size = 0;
+            for (std::size_t Next = 4096; Next <= (std::size_t(48) << 20); Next *= 3) {
+                ASSERT_TRUE(Arena.Grow(Next));
+                ASSERT_GE(Arena.GetSize(), Next);
+                ASSERT_EQ(Arena.Data(), Base);
+                Fill(Arena.Data(), Size, Next);
+                Size = Next;
+            }
+            ASSERT_TRUE(Check(Arena.Data(), Size));
+
+            errno = 0;
+            ASSERT_FALSE(Arena.Grow(65 << 20));
+            ASSERT_EQ(errno, ENOMEM);
+            ASSERT_TRUE(Check(Arena.Data(), Size));
+
+            auto Moved = std::move(Arena);
+            ASSERT_FALSE(Arena.IsEngaged());
+            ASSERT_EQ(Arena.GetSize(), 0);
+            ASSERT_EQ(Moved.Data(), Base);
+        }
+
+        {
+            auto Arena = GrowableMapping<GrowPolicy::MayMove>::Reserve(4096);
+            ASSERT_TRUE(Arena.IsEngaged());
+            Fill(Arena.Data(), 0, 4096);
+
+            std::size_t Size = 4096;
+            for (std::size_t Next = 8192; Next <= (std::size_t(64) << 20); Next *= 4) {
+                std::byte* Previous = Arena.Data();
+                ASSERT_TRUE(Arena.Grow(Next));
+                if (Arena.Data() != Previous) {
+                    ASSERT_FALSE(IsMapped(Previous));
+                }
+                ASSERT_TRUE(Check(Arena.Data(), Size));
+                Fill(Arena.Data(), Size, Next);
+                Size = Next;
+            }
+            ASSERT_EQ(Arena.Get().Get().Length, Arena.GetSize());
+        }
+
+        {
+            auto Fixed = GrowableMapping<GrowPolicy::Fixed>::Reserve(1 << 20, 4096);
+            auto Moving = GrowableMapping<GrowPolicy::MayMove>::Reserve(1 << 20, 4096);
+            ASSERT_EQ(Fixed.GetSize(), 4096);
+            ASSERT_EQ(Moving.GetSize(), 4096);
+            ASSERT_EQ(Moving.GetCapacity(), 4096);
+
+            auto Empty = GrowableMapping<GrowPolicy::MayMove>::Reserve(1 << 20);
+            ASSERT_TRUE(Empty.IsEngaged());
+            ASSERT_EQ(Empty.GetSize(), 0);
+            ASSERT_TRUE(Empty.Grow(1));
+            ASSERT_EQ(Empty.GetSize(), Empty.GetCapacity());
+        }
+
+        {
+            GrowableMapping<GrowPolicy::MayMove> Moving;
+            ASSERT_EQ(Moving.Data(), nullptr);
+
+            auto Failed = GrowableMapping<GrowPolicy::Fixed>::Reserve(std::size_t(-1) / 2);
+            ASSERT_FALSE(Failed.IsEngaged());
+            ASSERT_EQ(Failed.Data(), nullptr);
+        }
+    }
+}
\ No newline at end of file
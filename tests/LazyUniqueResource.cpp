@@ -0,0 +1,157 @@
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Scope/LazyUniqueResource.h>
+
+namespace {
+    int Acquired = 0;
+
+    int AcquireOne() noexcept {
+        return ++Acquired;
+    }
+}
+
+namespace stdx::tests {
+    TEST(Scope, LazyUniqueResource) {
+        {
+            int Value = 0;
+            {
+                LazyUniqueResource<int, std::function<void(int)>> Resource(&AcquireOne, [&Value](int R) { Value += R; });
+                ASSERT_FALSE(Resource.IsAcquired());
+                ASSERT_FALSE(Resource.IsEngaged());
+            }
+            ASSERT_EQ(Acquired, 0);
+            ASSERT_EQ(Value, 0);
+        }
+
+        {
+            int Calls = 0;
+            int Value = 0;
+            {
+                LazyUniqueResource Resource([&Calls]() { return ++Calls * 10; }, [&Value](int R) { Value += R; });
+                ASSERT_EQ(Resource.Get(), 10);
+                ASSERT_EQ(Resource.Get(), 10);
+                ASSERT_TRUE(Resource.IsAcquired());
+                ASSERT_TRUE(Resource.IsEngaged());
+                ASSERT_EQ(Calls, 1);
+
+                Resource.Reset();
+                ASSERT_EQ(Value, 10);
+                ASSERT_FALSE(Resource.IsAcquired());
+                ASSERT_EQ(Resource.Get(), 20);
+            }
+            ASSERT_EQ(Value, 30);
+        }
+
+        {
+            int Value = 0;
+            {
+                LazyUniqueResource Resource([]() { return 5; }, [&Value](int R) { Value += R; });
+                ASSERT_EQ(Resource.Get(), 5);
+                Resource.Release();
+                ASSERT_TRUE(Resource.IsAcquired());
+                ASSERT_FALSE(Resource.IsEngaged());
+            }
+            ASSERT_EQ(Value, 0);
+        }
+
+        {
+            int Value = 0;
+            {
+                LazyUniqueResource<int, std::function<void(int)>, Sentinel<-1>> Resource(
+                    []() { return -1; }, [&Value](int R) { Value += R; });
+                ASSERT_EQ(Resource.Get(), -1);
+                ASSERT_TRUE(Resource.IsAcquired());
+                ASSERT_FALSE(Resource.IsEngaged());
+            }
+            ASSERT_EQ(Value, 0);
+        }
+
+        {
+            int Calls = 0;
+            int Value = 0;
+            {
+                LazyUniqueResource Resource(
+                    [&Calls]() {
+                        if (++Calls == 1) {
+                            throw std::runtime_error{"oops"};
+                        }
+                        return Calls;
+                    },
+                    [&Value](int R) { Value += R; });
+                ASSERT_THROW((void) Resource.Get(), std::runtime_error);
+                ASSERT_FALSE(Resource.IsAcquired());
+                ASSERT_EQ(Resource.Get(), 2);
+            }
+            ASSERT_EQ(Value, 2);
+        }
+
+        {
+            std::atomic<int> Calls = 0;
+            std::atomic<int> Value = 0;
+            {
+                LazyUniqueResource Resource([&Calls]() { return ++Calls; }, [&Value](int R) { Value += R; });
+                std::vector<std::thread> Threads;
+                for (int I = 0; I < 8; ++I) {
+                    Threads.emplace_back([&Resource]() {
+                        for (int J = 0; J < 1000; ++J) {
+                            ASSERT_EQ(Resource.Get(), 1);
+                        }
+                    });
+                }
+                for (auto& Thread : Threads) {
+                    Thread.join();
+                }
+            }
+            ASSERT_EQ(Calls, 1);
+            ASSERT_EQ(Value, 1);
+        }
+
+        {
+            std::atomic<bool> bEntered = false;
+            std::atomic<bool> bProceed = false;
+            std::atomic<int> Value = 0;
+            {
+                LazyUniqueResource Resource(
+                    [&bEntered, &bProceed]() {
+                        bEntered = true;
+                        while (!bProceed) {
+                            std::this_thread::yield();
+                        }
+                        return 3;
+                    },
+                    [&Value](int R) { Value += R; });
+                std::thread Acquirer([&Resource]() { (void) Resource.Get(); });
+                while (!bEntered) {
+                    std::this_thread::yield();
+                }
+                std::thread Resetter([&Resource]() { Resource.Reset(); });
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                bProceed = true;
+                Acquirer.join();
+                Resetter.join();
+
+                ASSERT_FALSE(Resource.IsAcquired());
+                ASSERT_EQ(Value, 3);
+            }
+            ASSERT_EQ(Value, 3);
+        }
+
+        {
+            int Value = 0;
+            auto Destruct = [&Value](int R) { Value += R; };
+            {
+                LazyUniqueResource<int, decltype(Destruct)&, void, std::function<int()>> Resource([]() { return 7; }, Destruct);
+                ASSERT_EQ(&Resource.GetDeleter(), &Destruct);
+                ASSERT_EQ(Resource.Get(), 7);
+            }
+            ASSERT_EQ(Value, 7);
+        }
+    }
+}
\ No newline at end of file
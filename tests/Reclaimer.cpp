@@ -0,0 +1,90 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Scope/Reclaimer.h>
+#include <Scope/UniqueResource.h>
+
+namespace {
+    std::atomic<int> Closed = 0;
+
+    void Close(int Value) noexcept {
+        Closed += Value;
+    }
+}
+
+namespace stdx::tests {
+    TEST(Scope, Reclaimer) {
+        {
+            std::atomic<int> Value = 0;
+            {
+                Reclaimer Reclaimer;
+                std::vector<std::thread> Producers;
+                for (int I = 0; I < 4; ++I) {
+                    Producers.emplace_back([&Reclaimer, &Value]() {
+                        for (int J = 0; J < 10000; ++J) {
+                            Reclaimer.Defer([&Value]() noexcept { ++Value; });
+                        }
+                    });
+                }
+                for (auto& Producer : Producers) {
+                    Producer.join();
+                }
+                Reclaimer.Flush();
+                ASSERT_EQ(Value, 40000);
+                ASSERT_EQ(Reclaimer.GetPending(), 0);
+            }
+        }
+
+        {
+            std::atomic<int> Value = 0;
+            {
+                Reclaimer Reclaimer;
+                for (int I = 0; I < 5000; ++I) {
+                    Reclaimer.Defer([&Value]() noexcept { ++Value; });
+                }
+            }
+            ASSERT_EQ(Value, 5000);
+        }
+
+        {
+            std::atomic<bool> bBlocked = true;
+            std::thread::id Worker;
+            std::vector<std::thread::id> Callers;
+            {
+                BasicReclaimer<2> Reclaimer;
+                Reclaimer.Defer([&bBlocked, &Worker]() noexcept {
+                    Worker = std::this_thread::get_id();
+                    while (bBlocked) {
+                        std::this_thread::yield();
+                    }
+                });
+                for (int I = 0; I < 4; ++I) {
+                    Reclaimer.Defer([&Callers]() noexcept { Callers.push_back(std::this_thread::get_id()); });
+                }
+                ASSERT_GE(Callers.size(), 2);
+                for (auto Id : Callers) {
+                    ASSERT_EQ(Id, std::this_thread::get_id());
+                }
+                bBlocked = false;
+                Reclaimer.Flush();
+            }
+            ASSERT_EQ(Callers.size(), 4);
+            ASSERT_NE(Worker, std::this_thread::get_id());
+        }
+
+        {
+            Closed = 0;
+            Reclaimer Reclaimer;
+            {
+                UniqueResource Resource(3, DeferredDeleter(&Close, Reclaimer));
+                UniqueResource Other(4, DeferredDeleter(&Close, Reclaimer));
+                Other.Release();
+            }
+            Reclaimer.Flush();
+            ASSERT_EQ(Closed, 3);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include <Scope/Relocate.h>
+#include <Scope/Scope.h>
+#include <Scope/UniqueResource.h>
+
+namespace {
+    int Closed = 0;
+
+    void Close(int Handle) noexcept {
+        Closed += Handle;
+    }
+
+    struct ThrowOnConstruct {
+        explicit ThrowOnConstruct(bool bThrow) {
+            if (bThrow) {
+                throw std::logic_error{"oops"};
+            }
+        }
+    };
+}
+
+namespace stdx::tests {
+    TEST(Scope, Relocate) {
+        using Handle = UniqueResource<int, FunctionDeleter<&Close>>;
+        using Function = UniqueResource<int, std::function<void(int)>>;
+
+        static_assert(IsTriviallyRelocatableV<Handle>);
+        static_assert(IsTriviallyRelocatableV<UniqueResource<int*, void (*)(int*)>>);
+        static_assert(IsTriviallyRelocatableV<UniqueResource<int, FunctionDeleter<&Close>, Sentinel<-1>>>);
+        static_assert(!IsTriviallyRelocatableV<Function>);
+        static_assert(!IsTriviallyRelocatableV<UniqueResource<std::unique_ptr<int>, NoopDeleter>>);
+        static_assert(IsTriviallyRelocatableV<ScopeExit<void (*)()>>);
+        static_assert(!IsTriviallyRelocatableV<ScopeFail<std::function<void()>>>);
+
+        static_assert(std::is_trivially_destructible_v<UniqueResource<int, NoopDeleter>>);
+        static_assert(std::is_trivially_destructible_v<UniqueResource<int*, NoopDeleter, Sentinel<nullptr>>>);
+        static_assert(!std::is_trivially_destructible_v<UniqueResource<std::string, NoopDeleter>>);
+        static_assert(!std::is_trivially_destructible_v<Handle>);
+
+        {
+            Closed = 0;
+            {
+                RelocatingVector<Handle> Handles;
+                for (int I = 1; I <= 100; ++I) {
+                    Handles.EmplaceBack(I, FunctionDeleter<&Close>{});
+                }
+                ASSERT_EQ(Closed, 0);
+                ASSERT_EQ(Handles.GetSize(), 100);
+                ASSERT_GE(Handles.GetCapacity(), 100);
+                ASSERT_EQ(Handles[41].Get(), 42);
+
+                Handles.SwapErase(0);
+                ASSERT_EQ(Closed, 1);
+                ASSERT_EQ(Handles[0].Get(), 100);
+                Handles.SwapErase(Handles.GetSize() - 1);
+                ASSERT_EQ(Closed, 1 + 99);
+
+                Handles[1].Release();
+            }
+            ASSERT_EQ(Closed, 100 * 101 / 2 - 2);
+        }
+
+        {
+            int Value = 0;
+            {
+                RelocatingVector<Function> Functions;
+                Functions.Reserve(2);
+                for (int I = 1; I <= 10; ++I) {
+                    Functions.EmplaceBack(I, [&Value](int R) { Value += R; });
+                }
+                ASSERT_EQ(Value, 0);
+                RelocatingVector<Function> Moved = std::move(Functions);
+                ASSERT_TRUE(Functions.IsEmpty());
+                ASSERT_EQ(Moved.GetSize(), 10);
+            }
+            ASSERT_EQ(Value, 55);
+        }
+
+        {
+            RelocatingVector<ThrowOnConstruct> Values;
+            for (int I = 0; I < 4; ++I) {
+                Values.EmplaceBack(false);
+            }
+            ASSERT_THROW(Values.EmplaceBack(true), std::logic_error);
+            ASSERT_EQ(Values.GetSize(), 4);
+            ASSERT_EQ(Values.GetCapacity(), 4);
+        }
+
+        {
+            int Value = 0;
+            {
+                RelocatingVector<ScopeExit<std::function<void()>>> Scopes;
+                for (int I = 0; I < 9; ++I) {
+                    Scopes.EmplaceBack([&Value]() { ++Value; });
+                }
+                Scopes[3].Release();
+                ASSERT_EQ(Value, 0);
+            }
+            ASSERT_EQ(Value, 8);
+        }
+
+        {
+            Closed = 0;
+            alignas(Handle) unsigned char Buffer[2][sizeof(Handle)];
+            auto* Source = ::new (static_cast<void*>(Buffer[0])) Handle(7, FunctionDeleter<&Close>{});
+            auto* Destination = reinterpret_cast<Handle*>(Buffer[1]);
+            Relocate(Source, Destination);
+            ASSERT_EQ(Destination->Get(), 7);
+            Destination->~Handle();
+            ASSERT_EQ(Closed, 7);
+        }
+    }
+}
\ No newline at end of file
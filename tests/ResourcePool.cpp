@@ -0,0 +1,160 @@
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Scope/ResourcePool.h>
+
+namespace {
+    struct Counted {
+        Counted() noexcept {
+            ++Created;
+        }
+
+        Counted(const Counted&) noexcept : Counted() { }
+
+        ~Counted() {
+            ++Destroyed;
+        }
+
+        static inline std::atomic<int> Created = 0;
+        static inline std::atomic<int> Destroyed = 0;
+
+        std::vector<char> Data;
+    };
+}
+
+namespace stdx::tests {
+    TEST(Scope, ResourcePool) {
+        {
+            Counted::Created = 0;
+            Counted::Destroyed = 0;
+            {
+                ResourcePool<Counted> Pool([]() { return Counted(); });
+                Counted* Value = nullptr;
+                {
+                    auto Resource = Pool.Acquire();
+                    Resource->Data.resize(128);
+                    Value = Resource.Get();
+                }
+                ASSERT_EQ(Pool.GetLocalSize(), 1);
+                {
+                    auto Resource = Pool.Acquire();
+                    ASSERT_EQ(Resource.Get(), Value);
+                    ASSERT_EQ((*Resource).Data.size(), 128);
+                }
+                ASSERT_EQ(Counted::Created, 1);
+                ASSERT_EQ(Counted::Destroyed, 0);
+            }
+            ASSERT_EQ(Counted::Destroyed, 1);
+        }
+
+        {
+            Counted::Created = 0;
+            Counted::Destroyed = 0;
+            {
+                ResourcePool<Counted> Pool([]() { return Counted(); }, PoolOptions{4, 2});
+                {
+                    std::vector<ResourcePool<Counted>::Handle> Resources;
+                    for (int I = 0; I < 10; ++I) {
+                        Resources.push_back(Pool.Acquire());
+                    }
+                }
+                ASSERT_EQ(Counted::Created, 10);
+                ASSERT_LE(Pool.GetLocalSize(), 4);
+                ASSERT_EQ(Pool.GetLocalSize() + Pool.GetGlobalSize(), 10);
+
+                Pool.Trim(1);
+                ASSERT_EQ(Pool.GetLocalSize(), 1);
+                ASSERT_EQ(Pool.GetGlobalSize(), 0);
+                ASSERT_EQ(Counted::Destroyed, 9);
+            }
+            ASSERT_EQ(Counted::Destroyed, 10);
+        }
+
+        {
+            Counted::Created = 0;
+            Counted::Destroyed = 0;
+            {
+                ResourcePool<Counted> Pool([]() { return Counted(); }, PoolOptions{0, 0});
+                std::thread([&Pool]() {
+                    std::vector<ResourcePool<Counted>::Handle> Resources;
+                    for (int I = 0; I < 8; ++I) {
+                        Resources.push_back(Pool.Acquire());
+                    }
+                }).join();
+                ASSERT_EQ(Pool.GetGlobalSize(), 8);
+
+                std::vector<ResourcePool<Counted>::Handle> Resources;
+                for (int I = 0; I < 8; ++I) {
+                    Resources.push_back(Pool.Acquire());
+                }
+                ASSERT_EQ(Counted::Created, 8);
+                ASSERT_EQ(Pool.GetGlobalSize(), 0);
+            }
+            ASSERT_EQ(Counted::Destroyed, 8);
+        }
+
+        {
+            Counted::Created = 0;
+            Counted::Destroyed = 0;
+            {
+                ResourcePool<Counted> Pool([]() { return Counted(); }, PoolOptions{1, 0, 0});
+                {
+                    auto Resource1 = Pool.Acquire();
+                    auto Resource2 = Pool.Acquire();
+                    auto Resource3 = Pool.Acquire();
+                }
+                ASSERT_EQ(Pool.GetGlobalSize(), 0);
+                ASSERT_EQ(Counted::Destroyed, 2);
+            }
+            ASSERT_EQ(Counted::Destroyed, 3);
+        }
+
+        {
+            ResourcePool<Counted> Pool([]() { return Counted(); }, PoolOptions{2, 1});
+            std::vector<std::thread> Threads;
+            for (int I = 0; I < 4; ++I) {
+                Threads.emplace_back([&Pool]() {
+                    for (int J = 0; J < 1000; ++J) {
+                        auto Resource1 = Pool.Acquire();
+                        auto Resource2 = Pool.Acquire();
+                        auto Resource3 = Pool.Acquire();
+                    }
+                    Pool.Trim();
+                });
+            }
+            for (auto& Thread : Threads) {
+                Thread.join();
+            }
+        }
+
+        {
+            ASSERT_THROW(ResourcePool<Counted>([]() { return Counted(); }, PoolOptions{1, 2}), std::invalid_argument);
+        }
+
+        {
+            std::thread([]() {
+                std::vector<std::unique_ptr<ResourcePool<Counted>>> Pools;
+                for (int I = 0; I < 8; ++I) {
+                    Pools.push_back(std::make_unique<ResourcePool<Counted>>([]() { return Counted(); }));
+                    { auto Resource = Pools.back()->Acquire(); }
+                }
+
+                Counted::Destroyed = 0;
+                {
+                    ResourcePool<Counted> Unused([]() { return Counted(); });
+                    ASSERT_EQ(Unused.GetLocalSize(), 0);
+                    Unused.Trim();
+                }
+                ASSERT_EQ(Counted::Destroyed, 0);
+                for (auto& Pool : Pools) {
+                    ASSERT_EQ(Pool->GetLocalSize(), 1);
+                }
+            }).join();
+        }
+    }
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <optional>
+#include <system_error>
 
 #include <gtest/gtest.h>
 
@@ -26,6 +28,21 @@ namespace {
         bool bThrow;
         std::uint8_t& bWasCalled;
     };
+
+    struct PinnedCallable {
+        PinnedCallable(std::uint8_t& bWasCalled, std::uint8_t Step) noexcept : bWasCalled(bWasCalled), Step(Step) { }
+
+        PinnedCallable(const PinnedCallable&) = delete;
+
+        PinnedCallable(PinnedCallable&&) = delete;
+
+        void operator()() const noexcept {
+            bWasCalled += Step;
+        }
+
+        std::uint8_t& bWasCalled;
+        std::uint8_t Step;
+    };
 }
 
 namespace stdx::tests {
@@ -268,4 +285,201 @@ namespace stdx::tests {
             ASSERT_EQ(bWasCalled, 1);
         }
     }
+
+    TEST(Scope, ScopeCommit) {
+        {
+            bool bWasCalled = false;
+            {
+                ScopeCommit Scope([&bWasCalled]() { bWasCalled = true; });
+            }
+            ASSERT_FALSE(bWasCalled);
+        }
+
+        {
+            bool bWasCalled = false;
+            {
+                ScopeCommit Scope([&bWasCalled]() { bWasCalled = true; });
+                Scope.Commit();
+            }
+            ASSERT_TRUE(bWasCalled);
+        }
+
+        {
+            bool bWasCalled = false;
+            {
+                ScopeCommit Scope([&bWasCalled]() { bWasCalled = true; });
+                Scope.Release();
+                Scope.Commit();
+            }
+            ASSERT_FALSE(bWasCalled);
+        }
+
+        {
+            bool bWasCalled = false;
+            {
+                ScopeCommit Scope([&bWasCalled]() { bWasCalled = true; });
+                Scope.Commit(std::make_error_code(std::errc::io_error));
+            }
+            ASSERT_FALSE(bWasCalled);
+        }
+
+        {
+            bool bWasCalled = false;
+            {
+                ScopeCommit Scope([&bWasCalled]() { bWasCalled = true; });
+                Scope.Commit(std::error_code{});
+            }
+            ASSERT_TRUE(bWasCalled);
+        }
+
+        {
+            bool bWasCalled = false;
+            {
+                ScopeCommit Scope([&bWasCalled]() { bWasCalled = true; });
+                Scope.Commit(std::optional<int>(42));
+            }
+            ASSERT_TRUE(bWasCalled);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                ScopeCommit Scope1([&bWasCalled]() { ++bWasCalled; });
+                Scope1.Commit();
+                ScopeCommit Scope2 = std::move(Scope1);
+            }
+            ASSERT_EQ(bWasCalled, 1);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                ThrowCopyCallable Callable(true, bWasCalled);
+                ASSERT_THROW(ScopeCommit Scope(std::move(Callable)), std::logic_error);
+            }
+            ASSERT_EQ(bWasCalled, 0);
+        }
+    }
+
+    TEST(Scope, ScopeRollback) {
+        {
+            bool bWasCalled = false;
+            {
+                ScopeRollback Scope([&bWasCalled]() { bWasCalled = true; });
+            }
+            ASSERT_TRUE(bWasCalled);
+        }
+
+        {
+            bool bWasCalled = false;
+            {
+                ScopeRollback Scope([&bWasCalled]() { bWasCalled = true; });
+                Scope.Commit();
+            }
+            ASSERT_FALSE(bWasCalled);
+        }
+
+        {
+            bool bWasCalled = false;
+            {
+                ScopeRollback Scope([&bWasCalled]() { bWasCalled = true; });
+                Scope.Release();
+            }
+            ASSERT_FALSE(bWasCalled);
+        }
+
+        {
+            bool bWasCalled = false;
+            {
+                ScopeRollback Scope([&bWasCalled]() { bWasCalled = true; });
+                Scope.Commit(std::make_error_code(std::errc::io_error));
+            }
+            ASSERT_TRUE(bWasCalled);
+        }
+
+        {
+            bool bWasCalled = false;
+            {
+                ScopeRollback Scope([&bWasCalled]() { bWasCalled = true; });
+                Scope.Commit(std::optional<int>());
+            }
+            ASSERT_TRUE(bWasCalled);
+        }
+
+        {
+            bool bWasCalled = false;
+            {
+                try {
+                    ScopeRollback Scope([&bWasCalled]() { bWasCalled = true; });
+                    Scope.Commit();
+                    throw std::logic_error{"oops"};
+                } catch (...) { }
+            }
+            ASSERT_FALSE(bWasCalled);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                ScopeRollback Scope1([&bWasCalled]() { ++bWasCalled; });
+                ScopeRollback Scope2 = std::move(Scope1);
+            }
+            ASSERT_EQ(bWasCalled, 1);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                ThrowCopyCallable Callable(true, bWasCalled);
+                ASSERT_THROW(ScopeRollback Scope(std::move(Callable)), std::logic_error);
+            }
+            ASSERT_EQ(bWasCalled, 1);
+        }
+    }
+
+    TEST(Scope, Scope_InPlace) {
+        static_assert(!std::is_move_constructible_v<ScopeExit<PinnedCallable>>);
+        static_assert(!std::is_move_constructible_v<ScopeSuccess<PinnedCallable>>);
+        static_assert(!std::is_move_constructible_v<ScopeRollback<PinnedCallable>>);
+        static_assert(std::is_move_constructible_v<ScopeExit<ThrowCopyCallable>>);
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                auto Scope = MakeScopeExit<PinnedCallable>(bWasCalled, std::uint8_t(2));
+            }
+            ASSERT_EQ(bWasCalled, 2);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                ScopeExit<PinnedCallable> Scope(std::in_place, bWasCalled, std::uint8_t(1));
+                Scope.Release();
+            }
+            ASSERT_EQ(bWasCalled, 0);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                ScopeExit<ThrowCopyCallable> Scope1(std::in_place, true, bWasCalled);
+                ScopeExit<ThrowCopyCallable> Scope2(std::in_place, true, bWasCalled);
+                Scope2.Release();
+            }
+            ASSERT_EQ(bWasCalled, 1);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                ScopeSuccess<PinnedCallable> Success(std::in_place, bWasCalled, std::uint8_t(1));
+                ScopeFail<PinnedCallable> Fail(std::in_place, bWasCalled, std::uint8_t(4));
+                ScopeCommit<PinnedCallable> Commit(std::in_place, bWasCalled, std::uint8_t(8));
+                ScopeRollback<PinnedCallable> Rollback(std::in_place, bWasCalled, std::uint8_t(16));
+                Commit.Commit();
+            }
+            ASSERT_EQ(bWasCalled, 1 + 8 + 16);
+        }
+    }
 }
\ No newline at end of file
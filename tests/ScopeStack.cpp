@@ -0,0 +1,131 @@
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Scope/ScopeStack.h>
+
+namespace {
+    struct ThrowCopyCallable {
+        explicit ThrowCopyCallable(bool bThrow, std::uint8_t& bWasCalled) noexcept : bThrow(bThrow), bWasCalled(bWasCalled) { }
+
+        ThrowCopyCallable(const ThrowCopyCallable& Other) : bThrow(Other.bThrow), bWasCalled(Other.bWasCalled) {
+            if (bThrow) {
+                throw std::logic_error{"oops"};
+            }
+        }
+
+        ThrowCopyCallable(ThrowCopyCallable&&) noexcept = default;
+
+        void operator()() const noexcept {
+            ++bWasCalled;
+        }
+
+        bool bThrow;
+        std::uint8_t& bWasCalled;
+    };
+}
+
+namespace stdx::tests {
+    TEST(Scope, ScopeStack) {
+        {
+            std::string Log;
+            {
+                ScopeStack Stack;
+                ASSERT_TRUE(Stack.IsEmpty());
+                Stack.Push([&Log]() { Log += '1'; });
+                Stack.Push([&Log]() { Log += '2'; });
+                Stack.Push([&Log]() { Log += '3'; });
+                ASSERT_FALSE(Stack.IsEmpty());
+            }
+            ASSERT_EQ(Log, "321");
+        }
+
+        {
+            std::string Log;
+            {
+                ScopeStack<32> Stack;
+                for (char C = 'a'; C <= 'z'; ++C) {
+                    std::array<char, 40> Padding{};
+                    Padding[0] = C;
+                    Stack.Push([&Log, Padding]() { Log += Padding[0]; });
+                }
+            }
+            ASSERT_EQ(Log, "zyxwvutsrqponmlkjihgfedcba");
+        }
+
+        {
+            std::string Log;
+            {
+                ScopeStack Stack;
+                Stack.Push([&Log]() { Log += '1'; });
+                Stack.Release();
+                ASSERT_TRUE(Stack.IsEmpty());
+                Stack.Push([&Log]() { Log += '2'; });
+            }
+            ASSERT_EQ(Log, "2");
+        }
+
+        {
+            std::string Log;
+            {
+                ScopeStack<64> Outer;
+                {
+                    ScopeStack<64> Stack;
+                    for (char C = '0'; C <= '9'; ++C) {
+                        Stack.Push([&Log, C]() { Log += C; });
+                    }
+                    auto Stack2 = Stack.PopAll();
+                    ASSERT_TRUE(Stack.IsEmpty());
+                    Outer.Push([Inner = std::make_shared<ScopeStack<64>>(std::move(Stack2))]() { });
+                }
+                ASSERT_EQ(Log, "");
+            }
+            ASSERT_EQ(Log, "9876543210");
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                ScopeStack Stack;
+                Stack.Push(ThrowCopyCallable(false, bWasCalled));
+                ThrowCopyCallable Callable(true, bWasCalled);
+                ASSERT_THROW(Stack.Push(Callable), std::logic_error);
+                ASSERT_EQ(bWasCalled, 1);
+            }
+            ASSERT_EQ(bWasCalled, 2);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                ScopeStack Stack;
+                Stack.Push([Value = std::make_unique<int>(1), &bWasCalled]() { bWasCalled += std::uint8_t(*Value); });
+                ScopeStack Moved = std::move(Stack);
+                ASSERT_TRUE(Stack.IsEmpty());
+            }
+            ASSERT_EQ(bWasCalled, 1);
+        }
+
+        {
+            std::string Log;
+            {
+                ScopeStack<32> Stack;
+                for (char C = 'a'; C <= 'h'; ++C) {
+                    std::array<char, 40> Padding{};
+                    Padding[0] = C;
+                    Stack.Push([&Log, Padding]() { Log += Padding[0]; });
+                }
+                ScopeStack<32> Moved = Stack.PopAll();
+                ASSERT_TRUE(Stack.IsEmpty());
+                ASSERT_EQ(Log, "");
+            }
+            ASSERT_EQ(Log, "hgfedcba");
+        }
+    }
+}
\ No newline at end of file
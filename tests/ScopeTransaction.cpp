@@ -0,0 +1,124 @@
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Scope/ScopeTransaction.h>
+
+namespace {
+    struct ThrowCopyCallable {
+        explicit ThrowCopyCallable(bool bThrow, std::uint8_t& bWasCalled) noexcept : bThrow(bThrow), bWasCalled(bWasCalled) { }
+
+        ThrowCopyCallable(const ThrowCopyCallable& Other) : bThrow(Other.bThrow), bWasCalled(Other.bWasCalled) {
+            if (bThrow) {
+                throw std::logic_error{"oops"};
+            }
+        }
+
+        void operator()() const noexcept {
+            ++bWasCalled;
+        }
+
+        bool bThrow;
+        std::uint8_t& bWasCalled;
+    };
+}
+
+namespace stdx::tests {
+    TEST(Scope, ScopeTransaction) {
+        {
+            std::string Log;
+            {
+                ScopeTransaction Transaction;
+                Transaction.Attach([&Log]() { Log += '1'; });
+                Transaction.Attach([&Log]() { Log += '2'; });
+                ASSERT_EQ(Transaction.GetSize(), 2);
+            }
+            ASSERT_EQ(Log, "");
+        }
+
+        {
+            std::string Log;
+            {
+                try {
+                    ScopeTransaction Transaction;
+                    Transaction.Attach([&Log]() { Log += '1'; });
+                    Transaction.Attach([&Log]() { Log += '2'; });
+                    Transaction.Attach([&Log]() { Log += '3'; });
+                    throw std::logic_error{"oops"};
+                } catch (...) { }
+            }
+            ASSERT_EQ(Log, "321");
+        }
+
+        {
+            std::string Log;
+            {
+                try {
+                    ScopeTransaction Transaction;
+                    Transaction.Attach([&Log]() { Log += '1'; });
+                    Transaction.Release();
+                    Transaction.Attach([&Log]() { Log += '2'; });
+                    throw std::logic_error{"oops"};
+                } catch (...) { }
+            }
+            ASSERT_EQ(Log, "2");
+        }
+
+        {
+            std::string Log;
+            {
+                try {
+                    throw std::logic_error{"oops"};
+                } catch (...) {
+                    ScopeTransaction Transaction;
+                    Transaction.Attach([&Log]() { Log += '1'; });
+                }
+            }
+            ASSERT_EQ(Log, "");
+        }
+
+        {
+            std::string Log;
+            {
+                ScopeTransaction<2> Transaction;
+                Transaction.Attach([&Log]() { Log += '1'; });
+                Transaction.Attach([&Log]() { Log += '2'; });
+                ASSERT_THROW(Transaction.Attach([&Log]() { Log += '3'; }), std::length_error);
+                ASSERT_EQ(Log, "3");
+            }
+            ASSERT_EQ(Log, "3");
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                try {
+                    ScopeTransaction Transaction;
+                    Transaction.Attach(ThrowCopyCallable(false, bWasCalled));
+                    ThrowCopyCallable Callable(true, bWasCalled);
+                    Transaction.Attach(Callable);
+                } catch (const std::logic_error&) { }
+            }
+            ASSERT_EQ(bWasCalled, 2);
+        }
+
+        {
+            std::uint8_t bWasCalled = 0;
+            {
+                const auto Callable = [&bWasCalled]() {
+                    ++bWasCalled;
+                };
+                try {
+                    ScopeTransaction Transaction;
+                    Transaction.Attach(std::cref(Callable));
+                    throw std::logic_error{"oops"};
+                } catch (...) { }
+            }
+            ASSERT_EQ(bWasCalled, 1);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <Scope/SharedMemory.h>
+
+namespace {
+    bool IsOpen(int Fd) noexcept {
+        return ::fcntl(Fd, F_GETFD) != -1;
+    }
+}
+
+namespace stdx::tests {
+    TEST(Scope, SharedMemory) {
+        {
+            SharedMemory Memory = SharedMemory::Create("scope-test", 1 << 20);
+            ASSERT_TRUE(Memory.IsEngaged());
+            ASSERT_EQ(Memory.GetSize(), 1 << 20);
+            std::memcpy(Memory.Data(), "payload", 8);
+            ASSERT_TRUE(Memory.Freeze());
+            ASSERT_EQ(std::memcmp(Memory.Data(), "payload", 8), 0);
+
+            errno = 0;
+            ASSERT_EQ(::ftruncate(Memory.GetFd().Get(), 16), -1);
+            ASSERT_EQ(errno, EPERM);
+
+            const pid_t Child = ::fork();
+            ASSERT_NE(Child, -1);
+            if (Child == 0) {
+                SharedMemory Received = SharedMemory::Adopt(UniqueFd(::dup(Memory.GetFd().Get())));
+                const bool bValid = Received.IsEngaged() && Received.GetSize() == (1 << 20) &&
+                    std::memcmp(Received.Data(), "payload", 8) == 0 && Received.Data() != Memory.Data();
+                ::_exit(bValid ? 0 : 1);
+            }
+
+            int Status = 0;
+            ASSERT_EQ(::waitpid(Child, &Status, 0), Child);
+            ASSERT_TRUE(WIFEXITED(Status));
+            ASSERT_EQ(WEXITSTATUS(Status), 0);
+        }
+
+        {
+            SharedMemory Memory = SharedMemory::Create("scope-test", 4096);
+            const pid_t Child = ::fork();
+            ASSERT_NE(Child, -1);
+            if (Child == 0) {
+                SharedMemory Writer = SharedMemory::Adopt(UniqueFd(::dup(Memory.GetFd().Get())), PROT_READ | PROT_WRITE);
+                if (Writer.IsEngaged()) {
+                    std::memcpy(Writer.Data(), "reply", 6);
+                }
+                ::_exit(Writer.IsEngaged() ? 0 : 1);
+            }
+
+            int Status = 0;
+            ASSERT_EQ(::waitpid(Child, &Status, 0), Child);
+            ASSERT_EQ(WEXITSTATUS(Status), 0);
+            ASSERT_EQ(std::memcmp(Memory.Data(), "reply", 6), 0);
+        }
+
+        {
+            SharedMemory Memory1 = SharedMemory::Create("scope-test", 4096);
+            SharedMemory Memory2 = SharedMemory::Create("scope-test", 8192);
+            const int Fd1 = Memory1.GetFd().Get(), Fd2 = Memory2.GetFd().Get();
+            Memory1 = std::move(Memory2);
+            ASSERT_FALSE(IsOpen(Fd1));
+            ASSERT_FALSE(Memory2.IsEngaged());
+            ASSERT_EQ(Memory1.GetFd().Get(), Fd2);
+            ASSERT_EQ(Memory1.GetSize(), 8192);
+            Memory1.Reset();
+            ASSERT_FALSE(IsOpen(Fd2));
+            ASSERT_EQ(Memory1.GetSize(), 0);
+        }
+
+        {
+            errno = 0;
+            SharedMemory Memory = SharedMemory::Adopt(OpenFd("/dev/null", O_RDONLY | O_CLOEXEC));
+            ASSERT_FALSE(Memory.IsEngaged());
+            ASSERT_NE(errno, 0);
+        }
+
+        {
+            errno = 0;
+            SharedMemory Memory = SharedMemory::Create("scope-test", 0);
+            ASSERT_FALSE(Memory.IsEngaged());
+            ASSERT_EQ(errno, EINVAL);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Scope/SharedResource.h>
+
+namespace {
+    struct ThrowCopyDeleter {
+        explicit ThrowCopyDeleter(int* Value, bool bThrow) noexcept : Value(Value), bThrow(bThrow) { }
+
+        ThrowCopyDeleter(const ThrowCopyDeleter& Other) : Value(Other.Value), bThrow(Other.bThrow) {
+            if (bThrow) {
+                throw std::logic_error{"oops"};
+            }
+        }
+
+        void operator()(int Resource) const noexcept {
+            *Value += Resource;
+        }
+
+        int* Value;
+        bool bThrow;
+    };
+}
+
+namespace stdx::tests {
+    TEST(Scope, SharedResource) {
+        {
+            int Value = 0;
+            {
+                SharedResource Resource(&Value, [](int* R) { ++*R; });
+                static_assert(sizeof(Resource) == sizeof(void*));
+                ASSERT_EQ(Resource.GetCount(), 1);
+                {
+                    auto Copy = Resource;
+                    ASSERT_EQ(Resource.GetCount(), 2);
+                    ASSERT_EQ(Copy.Get(), &Value);
+                    auto Moved = std::move(Copy);
+                    ASSERT_FALSE(Copy);
+                    ASSERT_EQ(Moved.GetCount(), 2);
+                }
+                ASSERT_EQ(Value, 0);
+                ASSERT_EQ(Resource.GetCount(), 1);
+            }
+            ASSERT_EQ(Value, 1);
+        }
+
+        {
+            int Value = 0;
+            {
+                auto Resource1 = MakeSharedResource<LocalRefCount>(1, ThrowCopyDeleter(&Value, false));
+                auto Resource2 = MakeSharedResource<LocalRefCount>(2, ThrowCopyDeleter(&Value, false));
+                Resource2 = Resource1;
+                ASSERT_EQ(Value, 2);
+                ASSERT_EQ(Resource1.GetCount(), 2);
+                Resource2 = std::move(Resource1);
+                ASSERT_EQ(Resource2.GetCount(), 1);
+                Resource1.Reset();
+                ASSERT_EQ(Value, 2);
+            }
+            ASSERT_EQ(Value, 3);
+        }
+
+        {
+            int Value = 0;
+            ThrowCopyDeleter Deleter(&Value, true);
+            ASSERT_THROW((SharedResource<int, ThrowCopyDeleter>(5, Deleter)), std::logic_error);
+            ASSERT_EQ(Value, 5);
+        }
+
+        {
+            std::atomic<int> Value = 0;
+            {
+                auto Resource = MakeSharedResource<ShardedRefCount<4>>(&Value, [](std::atomic<int>* R) noexcept { ++*R; });
+                static_assert(sizeof(Resource) == 2 * sizeof(void*));
+                std::vector<std::thread> Threads;
+                for (int I = 0; I < 8; ++I) {
+                    Threads.emplace_back([Resource]() mutable {
+                        for (int J = 0; J < 10000; ++J) {
+                            auto Copy = Resource;
+                            auto Moved = std::move(Copy);
+                        }
+                    });
+                }
+                for (auto& Thread : Threads) {
+                    Thread.join();
+                }
+                ASSERT_EQ(Resource.GetCount(), 1);
+                ASSERT_EQ(Value, 0);
+            }
+            ASSERT_EQ(Value, 1);
+        }
+
+        {
+            std::atomic<int> Value = 0;
+            {
+                auto Resource = MakeSharedResource(&Value, [](std::atomic<int>* R) noexcept { ++*R; });
+                std::vector<std::thread> Threads;
+                for (int I = 0; I < 8; ++I) {
+                    Threads.emplace_back([Copy = Resource]() mutable {
+                        for (int J = 0; J < 10000; ++J) {
+                            auto Other = Copy;
+                        }
+                    });
+                }
+                Resource.Reset();
+                for (auto& Thread : Threads) {
+                    Thread.join();
+                }
+            }
+            ASSERT_EQ(Value, 1);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Scope/SlotMap.h>
+
+namespace {
+    struct RangeCloser {
+        void operator()(int Value) const noexcept {
+            Closed->push_back(Value);
+        }
+
+        void operator()(const int* First, const int* Last) const noexcept {
+            ++*Ranges;
+            Closed->insert(Closed->end(), First, Last);
+        }
+
+        std::vector<int>* Closed;
+        int* Ranges;
+    };
+
+    struct ThrowCopy {
+        explicit ThrowCopy(int Value) noexcept : Value(Value) { }
+
+        ThrowCopy(const ThrowCopy&) {
+            throw std::logic_error{"oops"};
+        }
+
+        ThrowCopy(ThrowCopy&&) noexcept = default;
+
+        ThrowCopy& operator=(ThrowCopy&&) noexcept = default;
+
+        int Value;
+    };
+}
+
+namespace stdx::tests {
+    TEST(Scope, SlotMap) {
+        {
+            int Value = 0;
+            {
+                SlotMap<int, std::function<void(int)>> Map([&Value](int R) { Value += R; });
+                const auto H1 = Map.Insert(1);
+                const auto H2 = Map.Insert(2);
+                const auto H3 = Map.Insert(4);
+                ASSERT_NE(H1, decltype(Map)::InvalidHandle);
+                ASSERT_EQ(Map.GetSize(), 3);
+                ASSERT_EQ(*Map.Find(H2), 2);
+
+                ASSERT_TRUE(Map.Erase(H1));
+                ASSERT_EQ(Value, 1);
+                ASSERT_FALSE(Map.Erase(H1));
+                ASSERT_EQ(Map.Find(H1), nullptr);
+                ASSERT_FALSE(Map.Contains(decltype(Map)::InvalidHandle));
+                ASSERT_EQ(Value, 1);
+
+                ASSERT_EQ(*Map.Find(H2), 2);
+                ASSERT_EQ(*Map.Find(H3), 4);
+
+                const auto H4 = Map.Insert(8);
+                ASSERT_NE(H4, H1);
+                ASSERT_FALSE(Map.Contains(H1));
+                ASSERT_TRUE(Map.Contains(H4));
+
+                int Sum = 0;
+                for (int R : Map) {
+                    Sum += R;
+                }
+                ASSERT_EQ(Sum, 14);
+            }
+            ASSERT_EQ(Value, 15);
+        }
+
+        {
+            SlotMap<int, void (*)(int) noexcept> Map([](int) noexcept { });
+            const auto Start = std::chrono::steady_clock::now();
+            for (int I = 0; I < (1 << 18); ++I) {
+                (void) Map.Insert(I);
+            }
+            ASSERT_LT(std::chrono::steady_clock::now() - Start, std::chrono::seconds(5));
+            ASSERT_EQ(Map.GetSize(), std::size_t(1) << 18);
+        }
+
+        {
+            SlotMap<int, std::function<void(int)>, std::uint32_t, 20> Map([](int) { });
+            std::vector<std::uint32_t> Handles;
+            for (int I = 0; I < 1000; ++I) {
+                Handles.push_back(Map.Insert(I));
+            }
+            for (std::size_t I = 0; I < Handles.size(); I += 2) {
+                ASSERT_TRUE(Map.Erase(Handles[I]));
+            }
+            ASSERT_EQ(Map.GetSize(), 500);
+            for (std::size_t I = 1; I < Handles.size(); I += 2) {
+                ASSERT_EQ(*Map.Find(Handles[I]), int(I));
+            }
+            for (std::size_t Position = 0; Position < Map.GetSize(); ++Position) {
+                ASSERT_EQ(Map.Find(Map.GetHandle(Position)), Map.Data() + Position);
+            }
+            for (int I = 0; I < 500; ++I) {
+                Map.Insert(I);
+            }
+            ASSERT_EQ(Map.GetSize(), 1000);
+            for (std::size_t I = 0; I < Handles.size(); I += 2) {
+                ASSERT_FALSE(Map.Contains(Handles[I]));
+            }
+        }
+
+        {
+            std::vector<int> Closed;
+            int Ranges = 0;
+            {
+                SlotMap<int, RangeCloser> Map(RangeCloser{&Closed, &Ranges});
+                std::vector<std::uint64_t> Handles;
+                for (int I = 0; I < 100; ++I) {
+                    Handles.push_back(Map.Insert(I));
+                }
+                Map.Erase(Handles[10]);
+                ASSERT_EQ(Closed, std::vector<int>{10});
+                Map.Reset();
+                ASSERT_TRUE(Map.IsEmpty());
+                ASSERT_FALSE(Map.Contains(Handles[20]));
+                Map.Insert(7);
+            }
+            ASSERT_EQ(Ranges, 2);
+            ASSERT_EQ(Closed.size(), 101);
+            ASSERT_EQ(Closed.back(), 7);
+        }
+
+        {
+            int Value = 0;
+            {
+                SlotMap<ThrowCopy, std::function<void(const ThrowCopy&)>> Map([&Value](const ThrowCopy& R) { Value += R.Value; });
+                ThrowCopy Resource(3);
+                ASSERT_THROW(Map.Insert(Resource), std::logic_error);
+                ASSERT_EQ(Value, 3);
+                ASSERT_TRUE(Map.IsEmpty());
+                Map.Insert(ThrowCopy(5));
+            }
+            ASSERT_EQ(Value, 8);
+        }
+
+        {
+            std::string Value;
+            {
+                SlotMap<std::string, std::function<void(const std::string&)>> Map([&Value](const std::string& R) { Value += R; });
+                const auto Handle = Map.Insert("Hello");
+                Map.Insert(", world!");
+                SlotMap Moved = std::move(Map);
+                ASSERT_TRUE(Map.IsEmpty());
+                ASSERT_FALSE(Map.Contains(Handle));
+                ASSERT_EQ(*Moved.Find(Handle), "Hello");
+            }
+            ASSERT_EQ(Value, "Hello, world!");
+        }
+    }
+}
\ No newline at end of file
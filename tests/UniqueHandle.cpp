@@ -0,0 +1,102 @@
+#include <cerrno>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <Scope/UniqueHandle.h>
+#include <Scope/UniqueResourceSet.h>
+
+namespace {
+    bool IsOpen(int Fd) noexcept {
+        return ::fcntl(Fd, F_GETFD) != -1;
+    }
+}
+
+namespace stdx::tests {
+    TEST(Scope, UniqueHandle) {
+        static_assert(sizeof(UniqueFd) == sizeof(int));
+        static_assert(sizeof(UniqueFile) == sizeof(std::FILE*));
+        static_assert(sizeof(UniqueDir) == sizeof(DIR*));
+        static_assert(std::is_nothrow_move_constructible_v<UniqueFd>);
+        static_assert(std::is_nothrow_move_assignable_v<UniqueFd>);
+
+        {
+            int Fd = -1;
+            {
+                UniqueFd Handle = OpenFd("/dev/null", O_RDONLY | O_CLOEXEC);
+                ASSERT_TRUE(Handle.IsEngaged());
+                Fd = Handle.Get();
+                ASSERT_TRUE(IsOpen(Fd));
+            }
+            ASSERT_FALSE(IsOpen(Fd));
+        }
+
+        {
+            errno = 0;
+            UniqueFd Handle = OpenFd("/nonexistent/file", O_RDONLY);
+            ASSERT_EQ(errno, ENOENT);
+            ASSERT_FALSE(Handle.IsEngaged());
+            ASSERT_EQ(Handle.Get(), -1);
+        }
+
+        {
+            errno = 0;
+            UniqueFile File = OpenFile("/nonexistent/file", "r");
+            ASSERT_EQ(errno, ENOENT);
+            ASSERT_FALSE(File.IsEngaged());
+        }
+
+        {
+            UniqueDir Dir = OpenDir("/");
+            ASSERT_TRUE(Dir.IsEngaged());
+            UniqueFile File = OpenFile("/dev/null", "r");
+            ASSERT_TRUE(File.IsEngaged());
+            ASSERT_EQ(std::fgetc(File.Get()), EOF);
+        }
+
+        {
+            errno = EAGAIN;
+            { UniqueFd Handle(::dup(STDIN_FILENO)); }
+            ASSERT_EQ(errno, EAGAIN);
+        }
+
+        {
+            std::vector<int> Fds;
+            {
+                std::vector<UniqueFd> Handles;
+                for (int I = 0; I < 64; ++I) {
+                    Handles.push_back(OpenFd("/dev/null", O_RDONLY | O_CLOEXEC));
+                    Fds.push_back(Handles.back().Get());
+                }
+                Handles.erase(Handles.begin(), Handles.begin() + 8);
+                for (int I = 0; I < 8; ++I) {
+                    ASSERT_FALSE(IsOpen(Fds[std::size_t(I)]));
+                }
+            }
+            for (int Fd : Fds) {
+                ASSERT_FALSE(IsOpen(Fd));
+            }
+        }
+
+        {
+            std::vector<int> Fds;
+            {
+                UniqueResourceSet<int, FdDeleter> Set;
+                for (int I = 0; I < 32; ++I) {
+                    Fds.push_back(::open("/dev/null", O_RDONLY | O_CLOEXEC));
+                    Set.Insert(Fds.back());
+                }
+                Set.Release(5);
+            }
+            for (std::size_t I = 0; I < Fds.size(); ++I) {
+                ASSERT_EQ(IsOpen(Fds[I]), I == 5);
+            }
+            ::close(Fds[5]);
+        }
+    }
+}
\ No newline at end of file
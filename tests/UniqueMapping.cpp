@@ -0,0 +1,80 @@
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <Scope/UniqueMapping.h>
+
+namespace stdx::tests {
+    TEST(Scope, UniqueMapping) {
+        static_assert(sizeof(UniqueMapping) == sizeof(Mapping));
+        static_assert(std::is_nothrow_move_constructible_v<UniqueMapping>);
+
+        {
+            UniqueMapping Region = MapAnonymous(1 << 16, MappingOptions{true});
+            ASSERT_TRUE(Region.IsEngaged());
+            ASSERT_EQ(Region.Get().Length, 1 << 16);
+            std::memset(Region.Get().Address, 42, Region.Get().Length);
+
+            UniqueMapping Moved = std::move(Region);
+            ASSERT_FALSE(Region.IsEngaged());
+            ASSERT_EQ(Moved.Get().Data()[100], std::byte{42});
+        }
+
+        {
+            UniqueMapping Region = MapAnonymous(3 << 20, MappingOptions{true, true});
+            ASSERT_TRUE(Region.IsEngaged());
+            ASSERT_EQ(reinterpret_cast<std::uintptr_t>(Region.Get().Address) % (2 << 20), 0);
+            ASSERT_GE(Region.Get().Length, std::size_t(3) << 20);
+            Region.Get().Data()[Region.Get().Length - 1] = std::byte{1};
+        }
+
+        {
+            UniqueMapping Region = MapAnonymous(4096, MappingOptions{false, false, true});
+            ASSERT_TRUE(Region.IsEngaged());
+            Region.Get().Data()[0] = std::byte{1};
+        }
+
+        {
+            errno = 0;
+            UniqueMapping Region = MapAnonymous(0);
+            ASSERT_FALSE(Region.IsEngaged());
+            ASSERT_EQ(errno, EINVAL);
+        }
+
+        {
+            char Path[] = "/tmp/scope-mapping-XXXXXX";
+            UniqueFd Fd(::mkstemp(Path));
+            ASSERT_TRUE(Fd.IsEngaged());
+            ASSERT_EQ(::write(Fd.Get(), "Hello, world!", 13), 13);
+
+            UniqueMapping File = MapFile(Path, MappingOptions{true});
+            ::unlink(Path);
+            ASSERT_TRUE(File.IsEngaged());
+            ASSERT_EQ(File.Get().Length, 13);
+            ASSERT_EQ(std::memcmp(File.Get().Address, "Hello, world!", 13), 0);
+        }
+
+        {
+            errno = 0;
+            UniqueMapping File = MapFile("/nonexistent/file");
+            ASSERT_FALSE(File.IsEngaged());
+            ASSERT_EQ(errno, ENOENT);
+        }
+
+        {
+            UniqueMapping Region = MapAnonymous(4096);
+            UniqueMappingLock Lock = LockMapping(Region.Get());
+            if (Lock.IsEngaged()) {
+                ASSERT_EQ(Lock.Get(), Region.Get());
+            } else {
+                ASSERT_TRUE(errno == ENOMEM || errno == EPERM || errno == EAGAIN);
+            }
+        }
+    }
+}
\ No newline at end of file
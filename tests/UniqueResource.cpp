@@ -71,6 +71,40 @@ namespace {
 
     template <typename U>
     ThrowCopyResource(bool, U)->ThrowCopyResource<U>;
+
+    void Increment(int* Value) noexcept {
+        ++*Value;
+    }
+
+    int Closed = 0;
+
+    void Close(int Handle) noexcept {
+        Closed += Handle;
+    }
+
+    struct Pinned {
+        Pinned(int Handle, int Offset) noexcept : Handle(Handle + Offset) { }
+
+        Pinned(const Pinned&) = delete;
+
+        Pinned(Pinned&&) = delete;
+
+        int Handle;
+    };
+
+    struct PinnedCloser {
+        explicit PinnedCloser(int Scale) noexcept : Scale(Scale) { }
+
+        PinnedCloser(const PinnedCloser&) = delete;
+
+        PinnedCloser(PinnedCloser&&) = delete;
+
+        void operator()(const Pinned& Value) const noexcept {
+            Closed += Value.Handle * Scale;
+        }
+
+        int Scale;
+    };
 }
 
 namespace stdx::tests {
@@ -390,4 +424,205 @@ namespace stdx::tests {
             ASSERT_FALSE(bWasCalled);
         }
     }
+
+    TEST(Scope, UniqueResource_Layout) {
+        const auto Lambda = [](int* Value) { ++*Value; };
+
+        static_assert(sizeof(UniqueResource<int*, decltype(Lambda)>) == sizeof(std::pair<int*, bool>));
+        static_assert(sizeof(UniqueResource<int*, FunctionDeleter<&Increment>>) == sizeof(std::pair<int*, bool>));
+        static_assert(sizeof(UniqueResource<int*, void (*)(int*)>) > sizeof(std::pair<int*, bool>));
+        static_assert(std::is_empty_v<FunctionDeleter<&Increment>>);
+
+        static_assert(std::is_nothrow_move_constructible_v<UniqueResource<int*, FunctionDeleter<&Increment>>>);
+        static_assert(std::is_nothrow_move_assignable_v<UniqueResource<int*, FunctionDeleter<&Increment>>>);
+        static_assert(!std::is_copy_constructible_v<UniqueResource<int*, FunctionDeleter<&Increment>>>);
+        static_assert(!std::is_copy_assignable_v<UniqueResource<int*, FunctionDeleter<&Increment>>>);
+        static_assert(!std::is_nothrow_move_constructible_v<UniqueResource<int, ThrowCopyCallable<int>>>);
+        static_assert(std::is_move_assignable_v<UniqueResource<int, ThrowCopyCallable<int>>>);
+        static_assert(!std::is_nothrow_move_assignable_v<UniqueResource<int, ThrowCopyCallable<int>>>);
+        static_assert(!std::is_move_assignable_v<UniqueResource<Pinned, PinnedCloser>>);
+        static_assert(!std::is_move_constructible_v<UniqueResource<Pinned, PinnedCloser>>);
+
+        static_assert(std::is_constructible_v<UniqueResource<int*, FunctionDeleter<&Increment>>, int*>);
+        static_assert(!std::is_constructible_v<UniqueResource<int*, void (*)(int*)>, int*>);
+        static_assert(!std::is_constructible_v<UniqueResource<int*, std::function<void(int*)>>, int*>);
+
+        {
+            int Value = 0;
+            {
+                UniqueResource Resource(&Value, Lambda);
+                UniqueResource Other = std::move(Resource);
+            }
+            ASSERT_EQ(Value, 1);
+        }
+
+        {
+            int Value = 0, Other = 10;
+            {
+                UniqueResource<int*, FunctionDeleter<&Increment>> Resource(&Value, FunctionDeleter<&Increment>{});
+                Resource.Reset(&Other);
+            }
+            ASSERT_EQ(Value, 1);
+            ASSERT_EQ(Other, 11);
+        }
+
+        {
+            int Value = 0, Other = 10;
+            {
+                using U = UniqueResource<int*, FunctionDeleter<&Increment>>;
+                U R1(&Value, FunctionDeleter<&Increment>{}), R2(&Other, FunctionDeleter<&Increment>{});
+                R2 = std::move(R1);
+                ASSERT_EQ(Other, 11);
+                ASSERT_EQ(R2.Get(), &Value);
+            }
+            ASSERT_EQ(Value, 1);
+        }
+    }
+
+    TEST(Scope, UniqueResource_Sentinel) {
+        using Handle = UniqueResource<int, FunctionDeleter<&Close>, Sentinel<-1>>;
+        using Pointer = UniqueResource<int*, FunctionDeleter<&Increment>, Sentinel<nullptr>>;
+
+        static_assert(sizeof(Handle) == sizeof(int));
+        static_assert(sizeof(Pointer) == sizeof(int*));
+
+        {
+            Closed = 0;
+            {
+                Handle Resource;
+                ASSERT_EQ(Resource.Get(), -1);
+            }
+            ASSERT_EQ(Closed, 0);
+        }
+
+        {
+            Closed = 0;
+            {
+                Handle Resource(3, FunctionDeleter<&Close>{});
+                ASSERT_EQ(Resource.Get(), 3);
+            }
+            ASSERT_EQ(Closed, 3);
+        }
+
+        {
+            Closed = 0;
+            { Handle Resource(-1, FunctionDeleter<&Close>{}); }
+            ASSERT_EQ(Closed, 0);
+        }
+
+        {
+            Closed = 0;
+            {
+                Handle Resource(3, FunctionDeleter<&Close>{});
+                Resource.Release();
+                ASSERT_EQ(Resource.Get(), -1);
+            }
+            ASSERT_EQ(Closed, 0);
+        }
+
+        {
+            Closed = 0;
+            {
+                Handle Resource(3, FunctionDeleter<&Close>{});
+                Resource.Reset();
+                ASSERT_EQ(Resource.Get(), -1);
+                ASSERT_EQ(Closed, 3);
+                Resource.Reset(5);
+                ASSERT_EQ(Closed, 3);
+            }
+            ASSERT_EQ(Closed, 8);
+        }
+
+        {
+            Closed = 0;
+            {
+                Handle R1(3, FunctionDeleter<&Close>{});
+                Handle R2 = std::move(R1);
+                ASSERT_EQ(R1.Get(), -1);
+                ASSERT_EQ(R2.Get(), 3);
+            }
+            ASSERT_EQ(Closed, 3);
+        }
+
+        {
+            Closed = 0;
+            {
+                Handle R1(3, FunctionDeleter<&Close>{}), R2(5, FunctionDeleter<&Close>{});
+                R2 = std::move(R1);
+                ASSERT_EQ(Closed, 5);
+                ASSERT_EQ(R1.Get(), -1);
+                ASSERT_EQ(R2.Get(), 3);
+            }
+            ASSERT_EQ(Closed, 8);
+        }
+
+        {
+            int Value = 0;
+            {
+                Pointer R1(&Value, FunctionDeleter<&Increment>{}), R2;
+                ASSERT_EQ(R2.Get(), nullptr);
+                R2 = std::move(R1);
+                ASSERT_EQ(R1.Get(), nullptr);
+            }
+            ASSERT_EQ(Value, 1);
+        }
+
+        {
+            Closed = 0;
+            {
+                Handle R1(3), R2(-1);
+                ASSERT_TRUE(R1.IsEngaged());
+                ASSERT_FALSE(R2.IsEngaged());
+            }
+            ASSERT_EQ(Closed, 3);
+        }
+    }
+
+    TEST(Scope, UniqueResource_InPlace) {
+        {
+            Closed = 0;
+            {
+                UniqueResource<Pinned, PinnedCloser> Resource(
+                    std::piecewise_construct, std::forward_as_tuple(1, 2), std::forward_as_tuple(10));
+                ASSERT_TRUE(Resource.IsEngaged());
+                ASSERT_EQ(Resource.Get().Handle, 3);
+                ASSERT_EQ(Resource.GetDeleter().Scale, 10);
+            }
+            ASSERT_EQ(Closed, 30);
+        }
+
+        {
+            Closed = 0;
+            {
+                UniqueResource<Pinned, PinnedCloser> Resource(
+                    std::piecewise_construct, std::forward_as_tuple(1, 2), std::forward_as_tuple(10));
+                Resource.Release();
+            }
+            ASSERT_EQ(Closed, 0);
+        }
+
+        {
+            Closed = 0;
+            {
+                UniqueResource<int, FunctionDeleter<&Close>, Sentinel<-1>> R1(
+                    std::piecewise_construct, std::forward_as_tuple(4), std::forward_as_tuple());
+                UniqueResource<int, FunctionDeleter<&Close>, Sentinel<-1>> R2(
+                    std::piecewise_construct, std::forward_as_tuple(-1), std::forward_as_tuple());
+                ASSERT_TRUE(R1.IsEngaged());
+                ASSERT_FALSE(R2.IsEngaged());
+            }
+            ASSERT_EQ(Closed, 4);
+        }
+
+        {
+            int Value = 0;
+            {
+                ThrowCopyCallable<int> Destruct(false, Value);
+                UniqueResource<int, ThrowCopyCallable<int>&> Resource(
+                    std::piecewise_construct, std::forward_as_tuple(5), std::forward_as_tuple(Destruct));
+                ASSERT_EQ(&Resource.GetDeleter(), &Destruct);
+            }
+            ASSERT_EQ(Value, 5);
+        }
+    }
 }
\ No newline at end of file
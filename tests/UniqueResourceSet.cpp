@@ -0,0 +1,110 @@
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Scope/UniqueResourceSet.h>
+
+namespace {
+    struct RangeCloser {
+        void operator()(int Value) const noexcept {
+            Closed->push_back(Value);
+        }
+
+        void operator()(const int* First, const int* Last) const noexcept {
+            Ranges->emplace_back(*First, *(Last - 1));
+            Closed->insert(Closed->end(), First, Last);
+        }
+
+        std::vector<int>* Closed;
+        std::vector<std::pair<int, int>>* Ranges;
+    };
+}
+
+namespace stdx::tests {
+    TEST(Scope, UniqueResourceSet) {
+        {
+            int Value = 0;
+            {
+                UniqueResourceSet<int, std::function<void(int)>> Set([&Value](int R) { Value += R; });
+                for (int I = 1; I <= 200; ++I) {
+                    ASSERT_EQ(Set.Insert(I), std::size_t(I - 1));
+                }
+                ASSERT_EQ(Set.GetSize(), 200);
+                ASSERT_EQ(Set.Get(41), 42);
+            }
+            ASSERT_EQ(Value, 200 * 201 / 2);
+        }
+
+        {
+            int Value = 0;
+            {
+                UniqueResourceSet<int, std::function<void(int)>> Set([&Value](int R) { Value += R; });
+                Set.Insert(1);
+                Set.Insert(2);
+                Set.Insert(4);
+                Set.Release(1);
+                ASSERT_TRUE(Set.IsEngaged(0));
+                ASSERT_FALSE(Set.IsEngaged(1));
+                Set.Reset(2);
+                ASSERT_EQ(Value, 4);
+                Set.Reset(2);
+                ASSERT_EQ(Value, 4);
+            }
+            ASSERT_EQ(Value, 5);
+        }
+
+        {
+            std::vector<int> Closed;
+            std::vector<std::pair<int, int>> Ranges;
+            {
+                UniqueResourceSet<int, RangeCloser> Set(RangeCloser{&Closed, &Ranges});
+                for (int I = 0; I < 300; ++I) {
+                    Set.Insert(I);
+                }
+                for (int I = 10; I < 20; ++I) {
+                    Set.Release(std::size_t(I));
+                }
+                Set.Release(63);
+                Set.Release(64);
+                Set.Release(299);
+            }
+            const std::vector<std::pair<int, int>> Expected = {{0, 9}, {20, 62}, {65, 298}};
+            ASSERT_EQ(Ranges, Expected);
+            ASSERT_EQ(Closed.size(), 300 - 13);
+        }
+
+        {
+            std::vector<int> Closed;
+            std::vector<std::pair<int, int>> Ranges;
+            {
+                UniqueResourceSet<int, RangeCloser> Set(RangeCloser{&Closed, &Ranges});
+                for (int I = 0; I < 128; ++I) {
+                    Set.Insert(I);
+                }
+                Set.Reset();
+                ASSERT_EQ(Set.GetSize(), 0);
+                Set.Insert(7);
+            }
+            const std::vector<std::pair<int, int>> Expected = {{0, 127}, {7, 7}};
+            ASSERT_EQ(Ranges, Expected);
+        }
+
+        {
+            std::string Value;
+            {
+                UniqueResourceSet<std::string, std::function<void(const std::string&)>> Set(
+                    [&Value](const std::string& R) { Value += R; });
+                Set.Insert("Hello");
+                Set.Insert(", world!");
+                UniqueResourceSet Moved = std::move(Set);
+                ASSERT_EQ(Set.GetSize(), 0);
+                ASSERT_EQ(Moved.GetSize(), 2);
+            }
+            ASSERT_EQ(Value, "Hello, world!");
+        }
+    }
+}
\ No newline at end of file
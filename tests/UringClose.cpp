@@ -0,0 +1,104 @@
+#include <cerrno>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <Scope/UniqueResource.h>
+#include <Scope/UniqueResourceSet.h>
+#include <Scope/UringClose.h>
+
+namespace {
+    int Open() noexcept {
+        return ::open("/dev/null", O_RDONLY | O_CLOEXEC);
+    }
+
+    bool IsOpen(int Fd) noexcept {
+        return ::fcntl(Fd, F_GETFD) != -1;
+    }
+
+    int CountOpen() noexcept {
+        int Count = 0;
+        if (DIR* Directory = ::opendir("/proc/self/fd")) {
+            while (::readdir(Directory)) {
+                ++Count;
+            }
+            ::closedir(Directory);
+        }
+        return Count;
+    }
+}
+
+namespace stdx::tests {
+    TEST(Scope, UringClose) {
+        {
+            std::thread([]() {
+                const int Before = CountOpen();
+                int Fds[2] = {Open(), Open()};
+                UringClose()(Fds[0]);
+                ASSERT_FALSE(IsOpen(Fds[0]));
+                UringClose()(Fds + 1, Fds + 2);
+                ASSERT_FALSE(IsOpen(Fds[1]));
+                ASSERT_EQ(CountOpen(), Before);
+            }).join();
+        }
+
+        {
+            int Fd = Open();
+            ASSERT_GE(Fd, 0);
+            {
+                UniqueResource Resource(Fd, UringClose());
+            }
+            ASSERT_FALSE(IsOpen(Fd));
+        }
+
+        {
+            std::vector<int> Fds;
+            {
+                UringCloseBatch Batch;
+                for (int I = 0; I < 8; ++I) {
+                    UniqueResource Resource(Open(), UringClose());
+                    Fds.push_back(Resource.Get());
+                }
+                if (details::UringRing::Local().IsAvailable()) {
+                    for (int Fd : Fds) {
+                        ASSERT_TRUE(IsOpen(Fd));
+                    }
+                }
+            }
+            for (int Fd : Fds) {
+                ASSERT_FALSE(IsOpen(Fd));
+            }
+        }
+
+        {
+            std::vector<int> Fds;
+            {
+                UringCloseBatch Batch;
+                UniqueResourceSet<int, UringClose> Set;
+                for (int I = 0; I < 200; ++I) {
+                    Fds.push_back(Open());
+                    Set.Insert(Fds.back());
+                }
+                Set.Release(3);
+            }
+            for (std::size_t I = 0; I < Fds.size(); ++I) {
+                ASSERT_EQ(IsOpen(Fds[I]), I == 3);
+            }
+            ::close(Fds[3]);
+        }
+
+        {
+            errno = EAGAIN;
+            {
+                UringCloseBatch Batch;
+                UniqueResource Resource(-1, UringClose());
+            }
+            ASSERT_EQ(errno, EAGAIN);
+        }
+    }
+}
\ No newline at end of file